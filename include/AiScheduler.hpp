@@ -0,0 +1,124 @@
+#ifndef AISCHEDULER_HPP
+#define AISCHEDULER_HPP
+
+#include <cstdint>
+#include <vector>
+#include "Vector2D.hpp"
+#include "Behavior.hpp"
+#include "TimingWheel.hpp"
+
+class Enemy;
+class Room;
+
+namespace AiRates {
+    // Un ennemi loin du joueur qui patrouille réfléchit à 10 Hz
+    // (une frame sur 6), les autres à 60 Hz
+    const int PATROL_INTERVAL = 6;
+
+    // Marge autour de la zone de détection où la patrouille repasse à
+    // pleine cadence : ni le joueur ni l'ennemi ne peuvent la franchir entre
+    // deux réflexions espacées
+    const float WAKE_MARGIN = 60.0f;
+
+    // Poursuite bloquée : replanifier au plus tard après ce délai, et
+    // revérifier le chemin une frame sur PATH_RECHECK_INTERVAL
+    const int BLOCKED_RETRY_TICKS = 6;
+    const int PATH_RECHECK_INTERVAL = 3;
+
+    // Plus long délai entre une réflexion et la suivante (voir Enemy::behave)
+    const int MAX_THINK_DELAY = PATROL_INTERVAL > BLOCKED_RETRY_TICKS ? PATROL_INTERVAL : BLOCKED_RETRY_TICKS;
+
+    // Coût estimé d'une réflexion, en microsecondes (mesuré sur une salle
+    // de niveau 1 à 6). Le budget se décompte avec ces estimations et non
+    // avec l'horloge : le choix des ennemis servis ne dépend pas de la
+    // machine, et la partie reste rejouable à l'identique.
+    const float FULL_THINK_COST_US = 1.0f;
+    const float PATROL_THINK_COST_US = 2.0f;
+
+    const float DEFAULT_BUDGET_US = 200.0f;
+}
+
+// Ordonnanceur des scripts d'ennemis (Enemy::behave).
+// Chaque script dort sur une condition de réveil : une frame (roue
+// temporelle, voir TimingWheel), le joueur qui entre ou sort d'un rayon, ou un chemin qui se
+// libère (liste de veille). Seuls les scripts dont la condition s'est
+// réalisée sont repris ; les autres prolongent leur dernier déplacement
+// (Enemy::drift) sans rien réévaluer.
+//
+// Les réveils urgents (joueur, chemin, poursuite, recul) passent toujours.
+// Les réflexions reportables des patrouilles lointaines se partagent le
+// budget de la frame, les plus en retard d'abord ; les autres attendent la
+// frame suivante.
+class AiScheduler {
+public:
+    explicit AiScheduler(int expectedEnemies);
+    ~AiScheduler();
+
+    void setBudget(float microseconds) { budget = microseconds; }
+    float getBudget() const { return budget; }
+
+    // (Re)lance le script de chaque ennemi. À appeler dès que la liste
+    // change (apparition, suppression, chargement) : les scripts gardent
+    // l'adresse de leur ennemi.
+    void attach(std::vector<Enemy>& enemies);
+
+    void update(std::vector<Enemy>& enemies, const Vector2D& playerPos, Room* room);
+
+    // Horloge des scripts, sauvegardée avec le monde
+    int32_t getTick() const { return context.tick; }
+    void setTick(int32_t tick) {
+        context.tick = tick;
+        timers.reset(tick);
+    }
+
+    // Bilan de la dernière frame
+    int getUrgentCount() const { return urgentCount; }
+    int getScheduledThinkCount() const { return scheduledThinkCount; }
+    int getDeferredCount() const { return deferredCount; }
+    int getSleepingCount() const { return sleepingCount; }
+    float getEstimatedCost() const { return estimatedCost; }
+    int getHeapFallbacks() const { return pool.getHeapFallbacks(); }
+
+private:
+    struct Slot {
+        Behavior::Task task;
+        TimerHandle timer;    // Réveil programmé, annulé à la reprise
+        int32_t generation;   // Incrémentée à chaque mise en sommeil
+        int32_t queuedTick;   // Dernière frame où le script a été mis en file
+    };
+
+    // Réveil échu reportable
+    struct DueThink {
+        int32_t tick;
+        int32_t index;
+    };
+
+    // Surveillance ; périmée si le script a été repris entre-temps
+    struct Watcher {
+        int32_t index;
+        int32_t generation;
+    };
+
+    void restart(std::vector<Enemy>& enemies, int index);
+    void resume(int index);
+    void sleep(int index);
+
+    // Réserve déclarée avant les scripts : détruite après eux
+    Behavior::FramePool pool;
+    Behavior::Context context;
+    float budget;
+
+    std::vector<Slot> slots;
+    TimingWheel timers;
+    std::vector<Watcher> watchers;
+    std::vector<int> urgent;
+    std::vector<DueThink> due;      // Réveils reportables échus
+
+    int urgentCount;
+    int scheduledThinkCount;
+    int deferredCount;
+    int sleepingCount;
+    float estimatedCost;
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef ALLOCATIONTRACKER_HPP
+#define ALLOCATIONTRACKER_HPP
+
+#include <cstdint>
+
+// Les opérateurs new/delete globaux ne sont remplacés qu'avec
+// "make PROFILE=1" (comptage) ou "make ALLOC_CHECK=1" (assertion)
+#if defined(AMAZING_BALL_PROFILE) || defined(AMAZING_BALL_ALLOC_CHECK)
+#define AMAZING_BALL_TRACK_ALLOCATIONS
+#endif
+
+struct AllocationStats {
+    uint64_t count;
+    uint64_t bytes;
+};
+
+class AllocationTracker {
+public:
+    // Cumul des allocations du thread appelant (les threads de travail
+    // ont leurs propres compteurs et n'entrent pas dans le bilan des frames)
+    static AllocationStats threadStats();
+
+    // Délimitation des frames par la boucle principale.
+    // En mode ALLOC_CHECK, toute allocation pendant une frame de jeu en
+    // régime permanent interrompt le programme sur l'allocation fautive.
+    static void beginFrame(bool steadyState);
+    static void endFrame();
+
+    // La frame courante devient une frame de transition (allocations tolérées)
+    static void markTransition();
+
+    static AllocationStats lastFrame();
+
+    static bool isEnabled();
+};
+
+#endif
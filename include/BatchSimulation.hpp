@@ -0,0 +1,113 @@
+#ifndef BATCHSIMULATION_HPP
+#define BATCHSIMULATION_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Difficulty.hpp"
+#include "InputState.hpp"
+#include "World.hpp"
+
+// Actions d'un environnement : touches de déplacement (InputKeys, bits 0 à 3)
+// plus les actions ponctuelles ci-dessous
+namespace BatchActions {
+    const uint8_t JUMP = 1 << 5;
+    const uint8_t ATTACK = 1 << 6;
+}
+
+// Disposition des observations d'un environnement (en unités du monde)
+namespace BatchObservation {
+    const int PLAYER_X = 0;
+    const int PLAYER_Y = 1;
+    const int PLAYER_GROUNDED = 2;  // 1 au sol, 0 en saut
+    const int HEALTH = 3;           // En quarts de cœur
+    const int LEVEL = 4;
+    const int ROOM_SCORE = 5;       // Score de la salle en cours
+    const int ELAPSED = 6;          // Temps passé dans la salle
+    const int CELEBRATING = 7;      // 1 si la sortie est atteinte
+    const int STAR_X = 8;
+    const int STAR_Y = 9;
+    const int SATELLITE_X = 10;     // Étoile satellite (mode difficile)
+    const int SATELLITE_Y = 11;
+    const int ENEMIES = 12;         // Par ennemi : x, y, vivant (0 si absent)
+    const int ENEMY_STRIDE = 3;
+    const int HOLES = ENEMIES + World::MAX_ENEMIES * ENEMY_STRIDE;
+    const int NEAREST_HOLES = 8;    // Trous les plus proches : dx, dy relatifs au joueur
+    const int HOLE_STRIDE = 2;
+    const int SIZE = HOLES + NEAREST_HOLES * HOLE_STRIDE;
+}
+
+// N parties indépendantes avancées d'une frame à la fois, en parallèle.
+// Les actions et observations sont des tableaux plats contigus
+// (environnement i : actions()[i], observations()[i * BatchObservation::SIZE]).
+// Une partie terminée redémarre aussitôt avec une nouvelle graine.
+class BatchSimulation {
+public:
+    // threadCount <= 0 : un thread par cœur
+    BatchSimulation(int envCount, int width, int height, int threadCount = 0);
+    ~BatchSimulation();
+
+    // Difficulté et niveau de départ d'un environnement (pris en compte au
+    // prochain redémarrage de sa partie)
+    void configure(int env, Difficulty difficulty, int level);
+
+    // Redémarre toutes les parties ; la graine de chaque partie dérive de
+    // (seed, environnement, difficulté, numéro de partie)
+    void reset(uint64_t seed);
+
+    // Une frame pour tous les environnements, à partir de actions()
+    void step();
+
+    int getEnvCount() const { return envCount; }
+    uint8_t* actions() { return actionBuffer.data(); }
+    const float* observations() const { return observationBuffer.data(); }
+    // Score total courant de chaque partie
+    const int* scores() const { return scoreBuffer.data(); }
+    // 1 si la partie s'est terminée pendant la dernière frame (puis redémarrée)
+    const uint8_t* done() const { return doneBuffer.data(); }
+    // Score final de la partie terminée (valide si done()[i])
+    const int* finalScores() const { return finalScoreBuffer.data(); }
+
+private:
+    BatchSimulation(const BatchSimulation&) = delete;
+    BatchSimulation& operator=(const BatchSimulation&) = delete;
+
+    struct EnvConfig {
+        Difficulty difficulty;
+        int level;
+        uint32_t episode;
+    };
+
+    void startEpisode(int env);
+    void stepRange(int begin, int end);
+    void writeObservation(int env);
+    void workerLoop(int chunk);
+    int chunkBegin(int chunk) const;
+
+    int envCount;
+    uint64_t baseSeed;
+    std::vector<std::unique_ptr<World>> worlds;
+    std::vector<EnvConfig> configs;
+
+    std::vector<uint8_t> actionBuffer;
+    std::vector<float> observationBuffer;
+    std::vector<int> scoreBuffer;
+    std::vector<uint8_t> doneBuffer;
+    std::vector<int> finalScoreBuffer;
+
+    // Pool de threads : le thread appelant traite le bloc 0,
+    // chaque thread de travail un bloc contigu d'environnements
+    int chunkCount;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeWorkers;
+    std::condition_variable chunksDone;
+    uint64_t generation;
+    int pendingChunks;
+    bool stopping;
+};
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef BEHAVIOR_HPP
+#define BEHAVIOR_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include "Vector2D.hpp"
+
+class Enemy;
+class Room;
+
+// Comportements d'ennemis écrits comme des coroutines C++20 : un script
+// s'endort sur une condition de réveil (co_await) et l'ordonnanceur
+// (AiScheduler) ne le reprend que lorsque cette condition est remplie.
+// Un ennemi endormi ne coûte rien à chaque frame.
+namespace Behavior {
+
+const int32_t NO_TICK = INT32_MAX;
+
+// Condition de réveil : la première des conditions actives qui se réalise
+struct WakeCondition {
+    int32_t tick;        // Réveil à partir de cette frame (NO_TICK : aucune)
+    float nearRadius;    // Joueur à moins de nearRadius (0 : aucune)
+    float farRadius;     // Joueur à plus de farRadius (0 : aucune)
+    bool waitPath;       // Chemin vers pathTarget sans trou (revérifié périodiquement)
+    bool deferrable;     // Réveil reportable si le budget de la frame est épuisé
+    Vector2D pathTarget;
+};
+
+// État partagé par les scripts d'un même monde pendant une reprise
+struct Context {
+    int32_t tick;
+    Vector2D playerPos;
+    Room* room;
+};
+
+// Réserve de blocs de taille fixe pour les cadres de coroutine : lancer un
+// script n'alloue pas sur le tas (sauf cadre trop grand ou réserve vide)
+class FramePool {
+public:
+    static const size_t BLOCK_SIZE = 512;
+
+    explicit FramePool(int blockCount);
+    ~FramePool();
+
+    void* allocate(size_t size);
+    static void release(void* frame);
+
+    int getHeapFallbacks() const { return heapFallbacks; }
+
+private:
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    // En-tête placé devant chaque cadre : réserve d'origine (nullptr : tas)
+    struct alignas(std::max_align_t) Header {
+        FramePool* pool;
+    };
+
+    unsigned char* storage;
+    void* freeList;
+    int heapFallbacks;
+};
+
+// Script en cours : propriétaire du cadre de la coroutine
+class Task {
+public:
+    struct promise_type {
+        WakeCondition wake;
+
+        // Le cadre est pris dans la réserve passée au script
+        static void* operator new(size_t size, Enemy&, FramePool& pool, Context&) {
+            return pool.allocate(size);
+        }
+        static void operator delete(void* frame) { FramePool::release(frame); }
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        // Démarrage différé : l'ordonnanceur amorce le script
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    Task() : handle(nullptr) {}
+    explicit Task(std::coroutine_handle<promise_type> h) : handle(h) {}
+    Task(Task&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle = other.handle;
+            other.handle = nullptr;
+        }
+        return *this;
+    }
+    ~Task() { destroy(); }
+
+    bool isRunning() const { return handle && !handle.done(); }
+    const WakeCondition& getWake() const { return handle.promise().wake; }
+
+    // Reprend le script jusqu'à sa prochaine attente ; false s'il est terminé
+    bool resume() {
+        handle.resume();
+        return !handle.done();
+    }
+
+    void destroy() {
+        if (handle) {
+            handle.destroy();
+            handle = nullptr;
+        }
+    }
+
+private:
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Attente d'une condition ; se combinent avec | (réveil à la première)
+struct Wait {
+    WakeCondition condition;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<Task::promise_type> h) const noexcept {
+        h.promise().wake = condition;
+    }
+    void await_resume() const noexcept {}
+};
+
+inline Wait operator|(Wait a, Wait b) {
+    Wait result = a;
+    // Le report ne concerne que le réveil à une frame donnée : il suit la
+    // frame retenue
+    if (b.condition.tick < a.condition.tick) {
+        result.condition.tick = b.condition.tick;
+        result.condition.deferrable = b.condition.deferrable;
+    } else if (b.condition.tick == a.condition.tick) {
+        result.condition.deferrable = a.condition.deferrable && b.condition.deferrable;
+    }
+    if (b.condition.nearRadius > 0.0f) result.condition.nearRadius = b.condition.nearRadius;
+    if (b.condition.farRadius > 0.0f) result.condition.farRadius = b.condition.farRadius;
+    if (b.condition.waitPath) {
+        result.condition.waitPath = true;
+        result.condition.pathTarget = b.condition.pathTarget;
+    }
+    return result;
+}
+
+inline Wait untilTick(int32_t tick) {
+    Wait wait = { { tick, 0.0f, 0.0f, false, false, Vector2D() } };
+    return wait;
+}
+
+// N frames à partir de la frame courante
+inline Wait waitTicks(const Context& context, int ticks) {
+    return untilTick(context.tick + ticks);
+}
+
+inline Wait untilPlayerWithin(float radius) {
+    Wait wait = { { NO_TICK, radius, 0.0f, false, false, Vector2D() } };
+    return wait;
+}
+
+inline Wait untilPlayerBeyond(float radius) {
+    Wait wait = { { NO_TICK, 0.0f, radius, false, false, Vector2D() } };
+    return wait;
+}
+
+inline Wait untilPathClear(const Vector2D& target) {
+    Wait wait = { { NO_TICK, 0.0f, 0.0f, true, false, target } };
+    return wait;
+}
+
+// Réveil secondaire : peut attendre une frame de plus si l'IA manque de budget
+inline Wait deferrable(Wait wait) {
+    wait.condition.deferrable = true;
+    return wait;
+}
+
+} // namespace Behavior
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef COLLISION_HPP
+#define COLLISION_HPP
+
+#include <cmath>
+#include "Vector2D.hpp"
+
+// Tests de collision continus : un cercle qui se déplace de from à to
+// pendant une frame. Un grand pas (recul, tick plus lent) ne peut plus
+// traverser un obstacle entre deux positions testées.
+namespace Collision {
+
+// Point du segment [from, to] à l'instant t (0 = from, 1 = to)
+inline Vector2D pointAt(const Vector2D& from, const Vector2D& to, float t) {
+    return Vector2D(from.x + (to.x - from.x) * t, from.y + (to.y - from.y) * t);
+}
+
+// Premier instant t dans [0, 1] où le centre, allant de from à to, entre dans
+// le disque (center, radius). false si le segment ne l'atteint pas, s'en
+// éloigne, ou part déjà de l'intérieur (cas résolu par les tests statiques).
+inline bool sweepCircle(const Vector2D& from, const Vector2D& to,
+                        const Vector2D& center, float radius, float& t) {
+    float fx = from.x - center.x;
+    float fy = from.y - center.y;
+    float c = fx * fx + fy * fy - radius * radius;
+    if (c <= 0.0f) return false;
+
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    float a = dx * dx + dy * dy;
+    float b = fx * dx + fy * dy;  // Demi-coefficient du terme en t
+    if (a == 0.0f || b >= 0.0f) return false;
+
+    float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) return false;
+
+    float hit = (-b - std::sqrt(discriminant)) / a;
+    if (hit > 1.0f) return false;
+
+    t = hit;
+    return true;
+}
+
+} // namespace Collision
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef CROWDSTEERING_HPP
+#define CROWDSTEERING_HPP
+
+#include <vector>
+#include "Vector2D.hpp"
+#include "SpatialGrid.hpp"
+
+class Enemy;
+
+// Pilotage de foule des ennemis : séparation (ne pas se chevaucher),
+// alignement (suivre le mouvement des voisins) et évitement (contourner un
+// voisin placé devant). Les voisins sont cherchés dans une grille
+// reconstruite à chaque frame en O(n) : chaque ennemi ne regarde que les
+// cellules proches, pas tous les autres ennemis.
+//
+// Tout est calculé à partir des positions de début de frame, avant le
+// déplacement des ennemis : le résultat ne dépend pas de l'ordre de mise à
+// jour.
+class CrowdSteering {
+public:
+    // Tampons dimensionnés pour maxEnemies ennemis : pas d'allocation en jeu
+    CrowdSteering(int width, int height, int maxEnemies);
+    ~CrowdSteering();
+
+    // Calcule la correction de chaque ennemi et la lui transmet (Enemy::setSteering)
+    void apply(std::vector<Enemy>& enemies);
+
+private:
+    SpatialGrid grid;
+
+    // Copie des ennemis en structure de tableaux pour le parcours des voisins
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> headingX;   // Vitesses normalisées (VectorBatch)
+    std::vector<float> headingY;
+    std::vector<float> radius;
+    std::vector<float> pointRadius;  // Rayons nuls pour la grille
+    std::vector<int> neighbours;
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef DIFFICULTY_HPP
+#define DIFFICULTY_HPP
+
+// Multiplicateur du nombre de trous par niveau
+enum class Difficulty {
+    EASY = 1,
+    MEDIUM = 2,
+    HARD = 3
+};
+
+#endif
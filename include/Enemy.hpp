@@ -2,7 +2,12 @@
 #define ENEMY_HPP
 
 #include "Vector2D.hpp"
-#include <SDL2/SDL.h>
+#include "Random.hpp"
+#include "Behavior.hpp"
+#include <cstdint>
+
+struct SDL_Renderer;
+struct EnemySnapshot;
 
 enum class EnemyState {
     IDLE,
@@ -16,23 +21,57 @@ class Room;
 
 class Enemy {
 public:
-    Enemy(float x, float y);
+    // patrolSeed : graine du flux de patrouille propre à cet ennemi
+    Enemy(float x, float y, uint64_t patrolSeed);
     ~Enemy();
 
-    void update(const Vector2D& playerPos, Room* room);
+    // Script de comportement (coroutine) : machine à états dont chaque
+    // état commence par attendre sa condition de réveil, calculée à partir
+    // des champs de l'ennemi. Un script relancé (chargement d'un instantané,
+    // ennemi touché) reprend donc exactement là où il attendait.
+    Behavior::Task behave(Behavior::FramePool& pool, Behavior::Context& context);
+
+    // Frames où le script dort : prolonger le dernier déplacement validé
+    // et animer
+    void drift();
+
+    // Le script doit être relancé (recul ou mort pendant son sommeil)
+    bool consumeInterrupt();
+
+    // Rang de l'ennemi pour étaler les réflexions des patrouilles lointaines
+    void setThinkSlot(int slot) { thinkSlot = slot; }
+
+    // Condition « chemin libre » d'un script endormi (voir Behavior::untilPathClear)
+    bool isPathClear(const Vector2D& target, Room* room) { return isPathSafe(target, room); }
+
     void render(SDL_Renderer* renderer);
 
     Vector2D getPosition() const { return position; }
+    Vector2D getVelocity() const { return velocity; }
     int getRadius() const { return radius; }
     int getLightRadius() const { return lightRadius; }
     bool isDead() const { return state == EnemyState::DEAD; }
 
     void takeDamage(int damage, const Vector2D& attackerPos);
 
+    // Correction de foule appliquée à la poursuite (voir CrowdSteering),
+    // recalculée avant chaque mise à jour
+    void setSteering(const Vector2D& correction) { steering = correction; }
+
+    // Instantané de l'état dynamique (voir Snapshot.hpp). loadState attend
+    // un instantané vérifié par isValid, aiTick étant l'horloge des scripts
+    // sauvegardée avec lui : état connu et prochaine réflexion au plus
+    // MAX_THINK_DELAY frames plus tard.
+    void saveState(EnemySnapshot& snapshot) const;
+    void loadState(const EnemySnapshot& snapshot);
+    static bool isValid(const EnemySnapshot& snapshot, int32_t aiTick);
+
 private:
     Vector2D position;
     Vector2D velocity;
     Vector2D patrolTarget;
+    Vector2D steering;
+    Random patrolRandom;
 
     EnemyState state;
 
@@ -45,8 +84,6 @@ private:
     float detectionRadius;
     float attackRadius;
 
-    int attackCooldown;
-    int attackCooldownMax;
 
     // Animation
     float animationPhase;
@@ -57,11 +94,23 @@ private:
     int knockbackFrames;
     int knockbackDuration;
 
+    // Réveil du script : frame de la prochaine réflexion (reportable pour
+    // une patrouille lointaine), frames de déplacement déjà validées, et
+    // pas bloqué d'une poursuite qui attend que le chemin se libère
+    int nextThinkTick;
+    bool thinkDeferrable;
+    int coastFrames;
+    bool chaseBlocked;
+    Vector2D blockedStep;
+    bool interrupted;
+    int thinkSlot;
+
     // Helpers
-    void updatePatrol(Room* room);
+    void updatePatrol(Room* room, int span);
     void updateChase(const Vector2D& playerPos, Room* room);
-    void updateAttack();
-    void updateKnockback();
+    void updateKnockback(Room* room);
+    void clampToArena();
+    void advanceAnimation();
 
     void drawFilledCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius);
     void drawGradientCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius,
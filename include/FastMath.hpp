@@ -0,0 +1,160 @@
+#ifndef FASTMATH_HPP
+#define FASTMATH_HPP
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+// Fonctions approchées pour les animations et le rendu : sinus et cosinus
+// par table, racine carrée inverse rapide. Jamais utilisées par la
+// simulation (voir SimMath.hpp) : elles ne changent que l'image.
+//
+// Les angles se comptent en unités de phase : un tour complet vaut 2^32, le
+// débordement des entiers non signés fait donc le modulo 2 pi sans calcul.
+namespace FastMath {
+
+// La table couvre un tour en 2^TABLE_BITS pas, interpolés linéairement
+const int TABLE_BITS = 10;
+const int TABLE_SIZE = 1 << TABLE_BITS;
+const int FRACTION_BITS = 32 - TABLE_BITS;
+const uint32_t QUARTER_TURN = 1u << 30;
+
+constexpr double PI = 3.14159265358979323846;
+
+// Sinus de référence, évalué à la compilation (série de Taylor après
+// réduction à [-pi, pi]) : sert à remplir la table et à en borner l'erreur
+constexpr double referenceSin(double x) {
+    while (x > PI) x -= 2.0 * PI;
+    while (x < -PI) x += 2.0 * PI;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 16; n++) {
+        term = -term * x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+// Une entrée de plus que de pas : l'interpolation lit toujours [i, i + 1]
+constexpr std::array<float, TABLE_SIZE + 1> makeSinTable() {
+    std::array<float, TABLE_SIZE + 1> table{};
+    for (int i = 0; i <= TABLE_SIZE; i++) {
+        table[i] = static_cast<float>(referenceSin(2.0 * PI * i / TABLE_SIZE));
+    }
+    return table;
+}
+
+constexpr std::array<float, TABLE_SIZE + 1> SIN_TABLE = makeSinTable();
+
+// Radians vers unités de phase : 2^32 / (2 pi)
+constexpr double RADIANS_TO_PHASE = 4294967296.0 / (2.0 * PI);
+
+// Angles jusqu'à environ 10^10 radians ; au-delà la conversion déborde
+constexpr uint32_t radiansToPhase(float radians) {
+    return static_cast<uint32_t>(static_cast<int64_t>(static_cast<double>(radians) * RADIANS_TO_PHASE));
+}
+
+constexpr uint32_t degreesToPhase(int degrees) {
+    return static_cast<uint32_t>(static_cast<int64_t>(degrees) * 4294967296LL / 360);
+}
+
+constexpr float sinPhase(uint32_t phase) {
+    uint32_t index = phase >> FRACTION_BITS;
+    float fraction = static_cast<float>(phase & ((1u << FRACTION_BITS) - 1)) * (1.0f / (1u << FRACTION_BITS));
+    float a = SIN_TABLE[index];
+    float b = SIN_TABLE[index + 1];
+    return a + (b - a) * fraction;
+}
+
+constexpr float cosPhase(uint32_t phase) {
+    return sinPhase(phase + QUARTER_TURN);
+}
+
+constexpr float sin(float radians) {
+    return sinPhase(radiansToPhase(radians));
+}
+
+constexpr float cos(float radians) {
+    return cosPhase(radiansToPhase(radians));
+}
+
+// 1 / sqrt(x) pour x > 0 : estimation par les bits du flottant, puis deux
+// itérations de Newton
+constexpr float rsqrt(float x) {
+    float half = 0.5f * x;
+    float y = std::bit_cast<float>(0x5f3759dfu - (std::bit_cast<uint32_t>(x) >> 1));
+    y = y * (1.5f - half * y * y);
+    y = y * (1.5f - half * y * y);
+    return y;
+}
+
+// sqrt(x) par rsqrt ; 0 pour x <= 0
+constexpr float sqrt(float x) {
+    return x > 0.0f ? x * rsqrt(x) : 0.0f;
+}
+
+// Bornes d'erreur vérifiées à la compilation
+namespace Accuracy {
+
+constexpr double MAX_SIN_ERROR = 1e-5;        // Absolue
+constexpr double MAX_RSQRT_ERROR = 1e-5;      // Relative
+
+constexpr double absolute(double value) {
+    return value < 0.0 ? -value : value;
+}
+
+// Erreur maximale sur chaque entrée de la table et au milieu de chaque pas
+// (pire cas de l'interpolation), pour le sinus et le cosinus
+constexpr double maxSinError() {
+    double worst = 0.0;
+    for (int i = 0; i < TABLE_SIZE; i++) {
+        for (uint32_t offset : { 0u, 1u << (FRACTION_BITS - 1) }) {
+            uint32_t phase = (static_cast<uint32_t>(i) << FRACTION_BITS) + offset;
+            double angle = 2.0 * PI * phase / 4294967296.0;
+            double sinError = absolute(sinPhase(phase) - referenceSin(angle));
+            double cosError = absolute(cosPhase(phase) - referenceSin(angle + PI / 2.0));
+            if (sinError > worst) worst = sinError;
+            if (cosError > worst) worst = cosError;
+        }
+    }
+    return worst;
+}
+
+constexpr double referenceSqrt(double x) {
+    double y = x > 1.0 ? x : 1.0;
+    for (int i = 0; i < 64; i++) {
+        y = 0.5 * (y + x / y);
+    }
+    return y;
+}
+
+// Erreur relative maximale de rsqrt de 2^-20 à 2^20, 16 points par octave
+constexpr double maxRsqrtError() {
+    double worst = 0.0;
+    for (int octave = -20; octave < 20; octave++) {
+        double scale = 1.0;
+        for (int k = 0; k < (octave < 0 ? -octave : octave); k++) {
+            scale = octave < 0 ? scale * 0.5 : scale * 2.0;
+        }
+        for (int step = 0; step < 16; step++) {
+            double x = scale * (1.0 + step / 16.0);
+            double expected = 1.0 / referenceSqrt(x);
+            double error = absolute(rsqrt(static_cast<float>(x)) - expected) / expected;
+            if (error > worst) worst = error;
+        }
+    }
+    return worst;
+}
+
+static_assert(maxSinError() <= MAX_SIN_ERROR, "Table de sinus trop imprécise");
+static_assert(maxRsqrtError() <= MAX_RSQRT_ERROR, "rsqrt trop imprécise");
+static_assert(sinPhase(0) == 0.0f && sinPhase(QUARTER_TURN) == 1.0f && cosPhase(0) == 1.0f,
+              "Valeurs exactes aux angles remarquables");
+static_assert(radiansToPhase(static_cast<float>(-PI / 2.0)) + QUARTER_TURN + 64 < 128,
+              "Les angles négatifs doivent boucler sur le tour");
+
+} // namespace Accuracy
+
+} // namespace FastMath
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef FIXED_HPP
+#define FIXED_HPP
+
+#include <array>
+#include <cstdint>
+
+// Nombre en virgule fixe Q16.16 : 16 bits entiers signés, 16 bits de fraction.
+// Uniquement de l'arithmétique entière : le même calcul donne le même résultat
+// au bit près quels que soient le compilateur, les options (-O0 / -O3) et la
+// libm, contrairement aux flottants (contraction FMA, sin/cos de la libm).
+class Fixed {
+public:
+    static const int FRACTION_BITS = 16;
+    static const int32_t ONE = 1 << FRACTION_BITS;
+
+    constexpr Fixed() : raw(0) {}
+    // Conversion depuis un flottant : multiplication exacte par 2^16 puis
+    // troncature, donc déterministe
+    constexpr Fixed(float value) : raw(static_cast<int32_t>(value * static_cast<float>(ONE))) {}
+    constexpr Fixed(int value) : raw(value * ONE) {}
+
+    static constexpr Fixed fromRaw(int32_t value) {
+        Fixed result;
+        result.raw = value;
+        return result;
+    }
+
+    constexpr int32_t getRaw() const { return raw; }
+    // Conversion exacte tant que la valeur tient dans les 24 bits de mantisse,
+    // arrondie (de façon déterministe) au-delà
+    constexpr float toFloat() const { return static_cast<float>(raw) / static_cast<float>(ONE); }
+    constexpr int toInt() const { return raw >> FRACTION_BITS; }
+
+    constexpr Fixed operator-() const { return fromRaw(-raw); }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b) { return fromRaw(a.raw + b.raw); }
+    friend constexpr Fixed operator-(Fixed a, Fixed b) { return fromRaw(a.raw - b.raw); }
+    friend constexpr Fixed operator*(Fixed a, Fixed b) {
+        return fromRaw(static_cast<int32_t>((static_cast<int64_t>(a.raw) * b.raw) >> FRACTION_BITS));
+    }
+    friend constexpr Fixed operator/(Fixed a, Fixed b) {
+        return b.raw == 0 ? Fixed() : fromRaw(static_cast<int32_t>((static_cast<int64_t>(a.raw) * ONE) / b.raw));
+    }
+
+    Fixed& operator+=(Fixed b) { raw += b.raw; return *this; }
+    Fixed& operator-=(Fixed b) { raw -= b.raw; return *this; }
+    Fixed& operator*=(Fixed b) { *this = *this * b; return *this; }
+    Fixed& operator/=(Fixed b) { *this = *this / b; return *this; }
+
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.raw == b.raw; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.raw != b.raw; }
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a.raw < b.raw; }
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a.raw > b.raw; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.raw <= b.raw; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.raw >= b.raw; }
+
+    // Racine carrée entière (arrondie par défaut)
+    static Fixed sqrt(Fixed value) {
+        if (value.raw <= 0) return Fixed();
+        return fromRaw(static_cast<int32_t>(isqrt(static_cast<uint64_t>(value.raw) << FRACTION_BITS)));
+    }
+
+    // sqrt(a² + b²) avec un produit intermédiaire sur 64 bits : pas de
+    // débordement pour des écarts de l'ordre de la taille de l'écran
+    static Fixed hypot(Fixed a, Fixed b) {
+        uint64_t sum = static_cast<uint64_t>(static_cast<int64_t>(a.raw) * a.raw) +
+                       static_cast<uint64_t>(static_cast<int64_t>(b.raw) * b.raw);
+        return fromRaw(static_cast<int32_t>(isqrt(sum)));
+    }
+
+    // Sinus et cosinus (angle en radians) par table, interpolée linéairement
+    static Fixed sin(Fixed angle);
+    static Fixed cos(Fixed angle);
+
+private:
+    int32_t raw;
+
+    static uint64_t isqrt(uint64_t value) {
+        uint64_t result = 0;
+        uint64_t bit = static_cast<uint64_t>(1) << 62;
+        while (bit > value) bit >>= 2;
+        while (bit != 0) {
+            if (value >= result + bit) {
+                value -= result + bit;
+                result = (result >> 1) + bit;
+            } else {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        return result;
+    }
+};
+
+namespace FixedTrig {
+
+// Un tour complet = TURN unités de phase ; la table couvre un quart de tour
+const int QUARTER = 1024;
+const int TURN = 4 * QUARTER;
+
+// sin(x) sur [0, pi/2] par série de Taylor, évaluée à la compilation :
+// chaque opération est arrondie selon IEEE par le compilateur lui-même,
+// la table est donc identique pour toutes les options de compilation
+constexpr double quarterSin(int index) {
+    double x = (3.14159265358979323846 / 2.0) * index / QUARTER;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; n++) {
+        term = -term * x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr std::array<int32_t, QUARTER + 1> makeQuarterTable() {
+    std::array<int32_t, QUARTER + 1> table{};
+    for (int i = 0; i <= QUARTER; i++) {
+        table[i] = static_cast<int32_t>(quarterSin(i) * Fixed::ONE + 0.5);
+    }
+    return table;
+}
+
+constexpr std::array<int32_t, QUARTER + 1> QUARTER_SIN = makeQuarterTable();
+
+// Sinus d'une phase en Q16.16 unités de phase (TURN unités par tour)
+inline Fixed sinPhase(int64_t phase) {
+    int64_t whole = phase >> Fixed::FRACTION_BITS;
+    int32_t fraction = static_cast<int32_t>(phase & (Fixed::ONE - 1));
+    int index = static_cast<int>(whole & (TURN - 1));
+
+    int quadrant = index / QUARTER;
+    int offset = index % QUARTER;
+
+    // Deux points consécutifs de la table dans le bon sens de parcours
+    int32_t a;
+    int32_t b;
+    if (quadrant == 0 || quadrant == 2) {
+        a = QUARTER_SIN[offset];
+        b = QUARTER_SIN[offset + 1];
+    } else {
+        a = QUARTER_SIN[QUARTER - offset];
+        b = QUARTER_SIN[QUARTER - offset - 1];
+    }
+
+    int32_t value = a + static_cast<int32_t>((static_cast<int64_t>(b - a) * fraction) >> Fixed::FRACTION_BITS);
+    return Fixed::fromRaw(quadrant >= 2 ? -value : value);
+}
+
+// Radians vers unités de phase : TURN / (2 pi), en Q16.16
+constexpr int64_t RADIANS_TO_PHASE = static_cast<int64_t>(TURN / (2.0 * 3.14159265358979323846) * Fixed::ONE + 0.5);
+
+} // namespace FixedTrig
+
+inline Fixed Fixed::sin(Fixed angle) {
+    return FixedTrig::sinPhase((static_cast<int64_t>(angle.raw) * FixedTrig::RADIANS_TO_PHASE) >> FRACTION_BITS);
+}
+
+inline Fixed Fixed::cos(Fixed angle) {
+    return FixedTrig::sinPhase(((static_cast<int64_t>(angle.raw) * FixedTrig::RADIANS_TO_PHASE) >> FRACTION_BITS) +
+                               (static_cast<int64_t>(FixedTrig::QUARTER) << FRACTION_BITS));
+}
+
+#endif
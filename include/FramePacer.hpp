@@ -0,0 +1,59 @@
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+#include <cstdint>
+
+// Cadence de la boucle mesurée avec le compteur haute résolution de SDL.
+// Chaque frame a une échéance fixe (début + n périodes) : le temps passé à
+// jouer et dessiner la frame est déduit de l'attente, et un retard n'est pas
+// reporté sur les frames suivantes. L'attente dort tant qu'il reste plus
+// d'une marge, puis boucle sur le compteur jusqu'à l'échéance exacte
+// (SDL_Delay n'a qu'une précision de l'ordre de la milliseconde).
+class FramePacer {
+public:
+    FramePacer();
+
+    // Période cible : 1 / framesPerSecond
+    void setTargetRate(int framesPerSecond);
+    // Fréquence de l'écran quand SDL_RenderPresent attend la synchronisation
+    // verticale (0 : sans vsync ou fréquence inconnue). Si elle correspond à
+    // la cadence cible, la présentation rythme déjà la boucle : le pacer
+    // n'attend plus que les frames sans présentation, et celles nettement
+    // trop courtes. Après une suite de frames trop courtes (écran à
+    // fréquence variable, compositeur qui ignore la vsync), il reprend
+    // l'attente chronométrée.
+    void setVsyncRefreshRate(int refreshRate);
+
+    // Repart de maintenant sans compter l'intervalle écoulé (après une
+    // attente d'inactivité, par exemple)
+    void restart();
+    // Attend l'échéance de la frame courante, puis fixe celle de la suivante.
+    // presented : la frame est passée par SDL_RenderPresent
+    void waitForNextFrame(bool presented);
+
+    // Intervalles entre frames : moyenne, écart-type, extrêmes, retards
+    void printReport() const;
+
+private:
+    double countsToMs(uint64_t counts) const;
+    // Dort puis boucle sur le compteur jusqu'à target ; renvoie l'instant atteint
+    uint64_t waitUntil(uint64_t target) const;
+
+    uint64_t frequency;     // Impulsions du compteur par seconde
+    uint64_t period;        // Durée d'une frame, en impulsions
+    uint64_t deadline;      // Fin de la frame courante
+    uint64_t lastFrame;     // Fin de l'attente précédente
+    bool started;
+    bool presentPaced;      // Vsync à la cadence cible : pas d'attente
+    int shortPresents;      // Frames présentées trop courtes d'affilée
+
+    // Statistiques des intervalles (algorithme de Welford, en ms)
+    uint64_t frameCount;
+    double meanMs;
+    double squaredDeviations;
+    double minMs;
+    double maxMs;
+    uint64_t lateFrames;
+};
+
+#endif
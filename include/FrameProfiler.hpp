@@ -0,0 +1,104 @@
+#ifndef FRAMEPROFILER_HPP
+#define FRAMEPROFILER_HPP
+
+#include "PerfCounters.hpp"
+#include "AllocationTracker.hpp"
+#include <chrono>
+
+// Phases mesurées à chaque frame (les phases peuvent être imbriquées)
+enum class ProfilePhase {
+    EVENTS,
+    UPDATE,
+    ENEMY_AI,     // Boucle de mise à jour des ennemis
+    PATH_SAFETY,  // Enemy::isPathSafe : appels comptés, temps dans ENEMY_AI
+    RENDER,
+    PLAYER_LIGHT, // Game::drawPlayerLight
+    COUNT
+};
+
+class FrameProfiler {
+public:
+    static FrameProfiler& getInstance();
+
+    bool init(int reportIntervalFrames = 120);
+
+    void beginFrame();
+    void endFrame();
+
+    void beginPhase(ProfilePhase phase);
+    void endPhase(ProfilePhase phase);
+    // Appel compté sans mesure : pour les fonctions courtes appelées dans
+    // une boucle déjà mesurée, où deux lectures d'horloge fausseraient le temps
+    void countCall(ProfilePhase phase);
+
+private:
+    FrameProfiler();
+    ~FrameProfiler();
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    struct PhaseStats {
+        double totalMs;           // Cumul sur la période de rapport
+        double counterTotals[static_cast<int>(PerfCounter::COUNT)];
+        uint64_t allocCount;
+        uint64_t allocBytes;
+        int calls;
+        int countedCalls;         // Appels comptés par countCall
+
+        // Début de la phase en cours
+        std::chrono::steady_clock::time_point start;
+        PerfSample startSample;
+        AllocationStats startAllocs;
+    };
+
+    void resetPhase(PhaseStats& stats);
+    void beginMeasure(PhaseStats& stats);
+    void endMeasure(PhaseStats& stats);
+
+    void report();
+    void resetStats();
+
+    PerfCounters counters;
+    bool countersOpen;
+    bool initialized;
+
+    PhaseStats phases[static_cast<int>(ProfilePhase::COUNT)];
+    PhaseStats frame;
+    int frameCount;
+    int reportInterval;
+};
+
+// Mesure d'une phase sur la durée d'un bloc
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfilePhase phase) : phase(phase) {
+        FrameProfiler::getInstance().beginPhase(phase);
+    }
+    ~ProfileScope() {
+        FrameProfiler::getInstance().endPhase(phase);
+    }
+
+private:
+    ProfilePhase phase;
+};
+
+// Instrumentation activée uniquement avec "make PROFILE=1"
+#ifdef AMAZING_BALL_PROFILE
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(phase) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(phase)
+#define PROFILE_BEGIN(phase) FrameProfiler::getInstance().beginPhase(phase)
+#define PROFILE_END(phase) FrameProfiler::getInstance().endPhase(phase)
+#define PROFILE_COUNT(phase) FrameProfiler::getInstance().countCall(phase)
+#define PROFILE_FRAME_BEGIN() FrameProfiler::getInstance().beginFrame()
+#define PROFILE_FRAME_END() FrameProfiler::getInstance().endFrame()
+#else
+#define PROFILE_SCOPE(phase) ((void)0)
+#define PROFILE_BEGIN(phase) ((void)0)
+#define PROFILE_END(phase) ((void)0)
+#define PROFILE_COUNT(phase) ((void)0)
+#define PROFILE_FRAME_BEGIN() ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#endif
+
+#endif
@@ -2,14 +2,19 @@
 #define GAME_HPP
 
 #include <SDL2/SDL.h>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
+#include "RoomBuilder.hpp"
+#include "HudCache.hpp"
+#include "FramePacer.hpp"
+#include "InputState.hpp"
+#include "Replay.hpp"
+#include "Simulation.hpp"
+#include "ScoreManager.hpp"
 
-class Player;
 class Map;
-class Enemy;
-class Menu;
-class Room;
 
 class Game {
 public:
@@ -20,13 +25,36 @@ public:
     void handleEvents();
     void update();
     void render();
+    // Fin de la période de la frame, hors de la mesure du profileur
+    void waitForNextFrame();
     void clean();
 
+    // Graine fixe pour toutes les parties (sinon une graine est tirée à chaque partie)
+    void setSeed(uint64_t seed);
+
+    // Cadence de la boucle (diviseur de 60 : 60, 30, 20, 15...) ;
+    // les résultats de jeu ne dépendent pas de la cadence choisie
+    bool setTickRate(int rate);
+    // Présentation synchronisée sur l'écran (avant init)
+    void setVsync(bool enabled) { vsync = enabled; }
+
+    // Enregistrement des entrées / relecture d'un fichier de replay
+    bool startRecording(const char* path);
+    bool startReplay(const char* path);
+
     bool running() const { return isRunning; }
 
+    // Bloque tant que rien ne bouge : fenêtre cachée (la partie est en
+    // pause, aucune frame n'est jouée ni enregistrée) ou écran fixe du menu
+    // (la frame suivante attend une touche). Rend la main dès qu'un
+    // événement doit être traité par handleEvents.
+    void waitWhileIdle();
+    // Partie en cours dans une salle : les frames ne doivent pas allouer
+    bool isSteadyGameplay() const;
+
     SDL_Renderer* getRenderer() const { return renderer; }
-    int getTotalScore() const { return totalScore; }
-    float getTotalTime() const { return totalTime; }
+    int getTotalScore() const;
+    float getTotalTime() const;
 
     void drawPlayerLight(int playerX, int playerY);
     void createLightTexture();
@@ -36,30 +64,58 @@ private:
     SDL_Renderer* renderer;
     bool isRunning;
 
-    std::unique_ptr<Player> player;
+    // État de la fenêtre, suivi par ses événements
+    bool windowHidden;      // Réduite ou cachée : pause
+    bool windowFocused;     // Sans focus : rendu ralenti
+    int unfocusedFrames;    // Frames sans focus, pour n'en dessiner qu'une partie
+
+    // État du jeu, sans dépendance à l'affichage ni à l'audio
+    std::unique_ptr<Simulation> simulation;
+    SimulationEvents events;
     std::unique_ptr<Map> map;
-    std::vector<std::unique_ptr<Enemy>> enemies;
-    std::unique_ptr<Menu> menu;
-    std::unique_ptr<Room> currentRoom;
+
+    // Préparation de la salle suivante en arrière-plan pendant la célébration
+    RoomBuilder roomBuilder;
+
+    // Graine fixée en ligne de commande ou par le replay (avant init)
+    uint64_t runSeed;
+    bool fixedSeed;
+
+    // Entrées de la frame courante (clavier réel ou replay)
+    InputFrame input;
+    InputRecorder recorder;
+    InputReplay replay;
+
+    // Scores annoncés de la session enregistrée (fichier "<replay>.scores")
+    std::string recordPath;
+    std::vector<ScoreRecord> sessionScores;
 
     SDL_Texture* lightTexture;
     int lightRadius;
 
-    bool gameStarted;
-    bool inRoom;
-    int currentLevel;
+    // Textures des éléments du HUD de salle
+    HudCache hud;
+
     int windowWidth;
     int windowHeight;
-    int totalScore;
-    float totalTime;
-    int playerLives;
-    int playerHealth; // Santé en quarts de cœur (4 = 1 cœur, 12 = 3 cœurs)
-    int invincibilityFrames; // Frames d'invincibilité après avoir pris un coup
-    const int invincibilityDuration = 90; // 1.5 secondes à 60 FPS
-    bool gameOver;
-
-    const int FPS = 60;
-    const int frameDelay = 1000 / FPS;
+
+    // La simulation avance toujours par pas de 1/60 s ; à une cadence de
+    // boucle plus basse, chaque tick enchaîne plusieurs sous-pas
+    static const int SIMULATION_RATE = 60;
+    int tickRate;
+    int substeps;
+    FramePacer pacer;
+    bool vsync;
+    bool framePresented;    // La dernière frame est passée par SDL_RenderPresent
+
+    // Entrées du sous-pas suivant d'un même tick ; false à la fin du replay
+    bool nextSubstepInput();
+    // Événements traités même en pause : fermeture, fenêtre, textures perdues
+    void handleWindowEvent(const SDL_Event& event);
+    bool isIdle() const;
+    // Fréquence de l'écran transmise au pacer quand la vsync est active
+    void applyVsyncRefreshRate();
+    void recordGameOver();
 };
 
 #endif
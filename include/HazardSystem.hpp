@@ -0,0 +1,99 @@
+#ifndef HAZARDSYSTEM_HPP
+#define HAZARDSYSTEM_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include "Vector2D.hpp"
+#include "SpatialGrid.hpp"
+
+namespace HazardLimits {
+    const int MAX_HAZARDS = 256;
+    // Taille des cellules de la phase large (environ 2 étoiles + le joueur)
+    const float CELL_SIZE = 64.0f;
+    // Rayon prévu par la grille (pulsation comprise) : au-delà, ses
+    // tampons peuvent grandir pendant une frame
+    const float MAX_RADIUS = 64.0f;
+}
+
+// Comportement d'un danger (étoile électrique)
+enum class HazardKind : uint8_t {
+    STATIC = 0,  // Immobile
+    ORBIT = 1,   // Tourne autour de son ancre (rayon extent)
+    PATROL = 2,  // Va-et-vient entre l'ancre et la cible
+    PULSE = 3    // Immobile, rayon qui oscille de baseRadius à baseRadius + extent
+};
+
+// Dangers rangés par champ (structure de tableaux) : la mise à jour parcourt
+// des tableaux contigus, et la structure est plate pour être copiée telle
+// quelle dans un instantané.
+struct HazardArrays {
+    int32_t count;
+    uint8_t kind[HazardLimits::MAX_HAZARDS];
+    // Position et rayon courants (collision et rendu)
+    float x[HazardLimits::MAX_HAZARDS];
+    float y[HazardLimits::MAX_HAZARDS];
+    float radius[HazardLimits::MAX_HAZARDS];
+    // Paramètres du mouvement
+    float baseRadius[HazardLimits::MAX_HAZARDS];
+    float anchorX[HazardLimits::MAX_HAZARDS];
+    float anchorY[HazardLimits::MAX_HAZARDS];
+    float targetX[HazardLimits::MAX_HAZARDS];
+    float targetY[HazardLimits::MAX_HAZARDS];
+    float extent[HazardLimits::MAX_HAZARDS];
+    float phase[HazardLimits::MAX_HAZARDS];   // Radians, dans [0, 2 pi]
+    float speed[HazardLimits::MAX_HAZARDS];   // Radians par frame
+};
+
+static_assert(std::is_trivially_copyable<HazardArrays>::value,
+              "HazardArrays doit rester copiable par memcpy");
+
+// Liste de dangers décrite par des données : une mise à jour groupée par
+// frame, puis une phase large (grille uniforme) pour que les tests de contact
+// ne regardent que les dangers proches du joueur.
+class HazardSystem {
+public:
+    HazardSystem(int screenWidth, int screenHeight);
+    ~HazardSystem();
+
+    void clear();
+
+    // Ajout d'un danger ; renvoie son indice, ou -1 si la liste est pleine
+    int addStatic(const Vector2D& position, float radius);
+    int addOrbit(const Vector2D& anchor, float orbitRadius, float speed, float radius);
+    int addPatrol(const Vector2D& from, const Vector2D& to, float speed, float radius);
+    int addPulse(const Vector2D& position, float baseRadius, float amplitude, float speed);
+
+    // Avance tous les dangers d'une frame
+    void update();
+
+    int getCount() const { return data.count; }
+    Vector2D getPosition(int index) const { return Vector2D(data.x[index], data.y[index]); }
+    float getRadius(int index) const { return data.radius[index]; }
+    const HazardArrays& getArrays() const { return data; }
+
+    // Dangers susceptibles de toucher un cercle de rayon radius allant de
+    // from à to (boîtes englobantes) ; indices croissants
+    int queryPath(const Vector2D& from, const Vector2D& to, float radius, int* out, int maxOut) const;
+
+    // Premier danger (plus petit indice) en contact avec le cercle, -1 sinon
+    int findContact(const Vector2D& position, float radius) const;
+
+    // L'état complet tient dans HazardArrays (voir Snapshot.hpp). loadState
+    // refuse (false, état inchangé) des tableaux qui ne passent pas isValid.
+    void saveState(HazardArrays& snapshot) const { snapshot = data; }
+    bool loadState(const HazardArrays& snapshot);
+    // Nombre dans [0, MAX_HAZARDS] et comportements connus
+    static bool isValid(const HazardArrays& arrays);
+
+private:
+    HazardArrays data;
+
+    // Reconstruite à la demande après un changement de positions
+    mutable SpatialGrid grid;
+    mutable bool gridDirty;
+
+    int add(HazardKind kind, const Vector2D& anchor, float radius, float speed);
+    const SpatialGrid& broadphase() const;
+};
+
+#endif
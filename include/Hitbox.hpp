@@ -0,0 +1,91 @@
+#ifndef HITBOX_HPP
+#define HITBOX_HPP
+
+#include "Vector2D.hpp"
+#include "Player.hpp"
+
+// Zones de touche orientées. L'attaque du joueur est une capsule (segment
+// épaissi) dans la direction regardée ; les contacts sont des cercles.
+namespace Hitbox {
+
+struct DirectionVector {
+    float x;
+    float y;
+    // Allongement de la portée : la portée se mesure sur chaque axe, une
+    // diagonale porte donc sqrt(2) fois plus loin (comme l'éclair dessiné)
+    float reachScale;
+};
+
+const float DIAGONAL = 0.70710678f;  // 1 / sqrt(2)
+const float DIAGONAL_REACH = 1.41421356f;
+
+// Vecteurs unitaires indexés par Direction
+constexpr DirectionVector DIRECTIONS[8] = {
+    { 0.0f,      1.0f,      1.0f },            // DOWN
+    { 0.0f,      -1.0f,     1.0f },            // UP
+    { -1.0f,     0.0f,      1.0f },            // LEFT
+    { 1.0f,      0.0f,      1.0f },            // RIGHT
+    { -DIAGONAL, DIAGONAL,  DIAGONAL_REACH },  // DOWN_LEFT
+    { DIAGONAL,  DIAGONAL,  DIAGONAL_REACH },  // DOWN_RIGHT
+    { -DIAGONAL, -DIAGONAL, DIAGONAL_REACH },  // UP_LEFT
+    { DIAGONAL,  -DIAGONAL, DIAGONAL_REACH }   // UP_RIGHT
+};
+
+static_assert(DIRECTIONS[static_cast<int>(Direction::UP_RIGHT)].x > 0.0f &&
+              DIRECTIONS[static_cast<int>(Direction::UP_RIGHT)].y < 0.0f,
+              "Table des directions désalignée avec l'énumération Direction");
+
+constexpr const DirectionVector& directionVector(Direction direction) {
+    return DIRECTIONS[static_cast<int>(direction)];
+}
+
+// Segment [start, end] épaissi de radius
+struct Capsule {
+    Vector2D start;
+    Vector2D end;
+    float radius;
+};
+
+// Zone de l'épée : de l'origine jusqu'à reach dans la direction regardée,
+// large de 2 * halfWidth. Le segment commence à halfWidth devant l'origine :
+// rien n'est touché derrière le joueur.
+inline Capsule orientedCapsule(const Vector2D& origin, Direction direction, float reach, float halfWidth) {
+    const DirectionVector& d = directionVector(direction);
+    float length = reach * d.reachScale;
+    Capsule capsule;
+    capsule.start = Vector2D(origin.x + d.x * halfWidth, origin.y + d.y * halfWidth);
+    capsule.end = Vector2D(origin.x + d.x * (length - halfWidth), origin.y + d.y * (length - halfWidth));
+    capsule.radius = halfWidth;
+    return capsule;
+}
+
+// Boîte englobante (pour la phase large)
+inline void bounds(const Capsule& capsule, float& minX, float& minY, float& maxX, float& maxY) {
+    minX = (capsule.start.x < capsule.end.x ? capsule.start.x : capsule.end.x) - capsule.radius;
+    minY = (capsule.start.y < capsule.end.y ? capsule.start.y : capsule.end.y) - capsule.radius;
+    maxX = (capsule.start.x > capsule.end.x ? capsule.start.x : capsule.end.x) + capsule.radius;
+    maxY = (capsule.start.y > capsule.end.y ? capsule.start.y : capsule.end.y) + capsule.radius;
+}
+
+// La capsule touche-t-elle le disque (center, radius) ?
+inline bool overlapsCircle(const Capsule& capsule, const Vector2D& center, float radius) {
+    float sx = capsule.end.x - capsule.start.x;
+    float sy = capsule.end.y - capsule.start.y;
+    float px = center.x - capsule.start.x;
+    float py = center.y - capsule.start.y;
+
+    // Point du segment le plus proche du centre
+    float lengthSq = sx * sx + sy * sy;
+    float t = lengthSq > 0.0f ? (px * sx + py * sy) / lengthSq : 0.0f;
+    if (t < 0.0f) t = 0.0f;
+    if (t > 1.0f) t = 1.0f;
+
+    float dx = px - sx * t;
+    float dy = py - sy * t;
+    float reach = capsule.radius + radius;
+    return dx * dx + dy * dy <= reach * reach;
+}
+
+} // namespace Hitbox
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef HUDCACHE_HPP
+#define HUDCACHE_HPP
+
+#include <SDL2/SDL.h>
+
+// Élément du HUD gardé dans sa propre texture : redessiné seulement quand
+// la valeur affichée change, sinon recopié tel quel (une copie par frame).
+//
+//     if (widget.beginRedraw(renderer, value, x, y, width, height)) {
+//         ...tracé, origine en haut à gauche de l'élément...
+//         widget.endRedraw(renderer);
+//     }
+//     widget.draw(renderer);
+//
+// Sans textures cibles (SDL_RENDERER_TARGETTEXTURE absent, création ou
+// sélection de la texture refusée), l'élément est tracé directement à
+// l'écran à chaque frame, dans une zone d'affichage placée en (x, y).
+class HudWidget {
+public:
+    HudWidget();
+    ~HudWidget();
+
+    // true si l'élément doit être redessiné (premier affichage, valeur ou
+    // taille changée, texture perdue, ou tracé direct) : le renderer dessine
+    // alors dans la texture, vidée, ou dans sa zone de l'écran jusqu'à
+    // endRedraw(). false si la texture est à jour.
+    bool beginRedraw(SDL_Renderer* renderer, int value, int x, int y, int width, int height);
+    void endRedraw(SDL_Renderer* renderer);
+
+    // Copie de la texture à la position donnée à beginRedraw
+    void draw(SDL_Renderer* renderer) const;
+
+    // Oublie la valeur : le prochain beginRedraw redessine
+    void invalidate() { valid = false; }
+    // Libère la texture ; le prochain beginRedraw retente les textures cibles
+    void release();
+
+private:
+    HudWidget(const HudWidget&) = delete;
+    HudWidget& operator=(const HudWidget&) = delete;
+
+    bool beginDirect(SDL_Renderer* renderer);
+
+    SDL_Texture* texture;
+    SDL_Texture* previousTarget;  // Cible à rétablir par endRedraw
+    SDL_Rect previousViewport;    // Zone à rétablir après un tracé direct
+    int x;
+    int y;
+    int width;
+    int height;
+    int value;
+    bool valid;
+    bool direct;                  // Tracé direct à l'écran, sans texture
+};
+
+// Éléments du HUD de salle (voir Room::renderHUD). Appartient au jeu : les
+// textures vivent avec le renderer, pas avec les salles.
+struct HudCache {
+    HudWidget instruction;
+    HudWidget hearts;
+    HudWidget timer;
+    HudWidget score;
+
+    // Textures cibles perdues (SDL_RENDER_TARGETS_RESET) : tout redessiner
+    void invalidate();
+    void release();
+};
+
+#endif
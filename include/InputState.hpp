@@ -0,0 +1,45 @@
+#ifndef INPUTSTATE_HPP
+#define INPUTSTATE_HPP
+
+#include <cstdint>
+
+// Touches maintenues lues à chaque frame par Player::handleInput
+namespace InputKeys {
+    const uint8_t UP = 1 << 0;
+    const uint8_t DOWN = 1 << 1;
+    const uint8_t LEFT = 1 << 2;
+    const uint8_t RIGHT = 1 << 3;
+    const uint8_t REWIND = 1 << 4;  // Retour en arrière (Simulation)
+}
+
+// Événement clavier transmis au menu et au joueur
+struct InputEvent {
+    uint32_t type;  // SDL_EventType
+    int32_t key;    // SDL_Keycode
+};
+
+// Entrées d'une frame : instantané du clavier + événements reçus.
+// Taille fixe : enregistrer ou rejouer une frame n'alloue rien.
+struct InputFrame {
+    static const int MAX_EVENTS = 16;
+
+    uint8_t heldKeys;
+    int eventCount;
+    InputEvent events[MAX_EVENTS];
+
+    void clear() {
+        heldKeys = 0;
+        eventCount = 0;
+    }
+
+    // Les événements au-delà de MAX_EVENTS dans une même frame sont ignorés
+    void addEvent(uint32_t type, int32_t key) {
+        if (eventCount < MAX_EVENTS) {
+            events[eventCount].type = type;
+            events[eventCount].key = key;
+            eventCount++;
+        }
+    }
+};
+
+#endif
@@ -2,8 +2,9 @@
 #define MENU_HPP
 
 #include <SDL2/SDL.h>
-#include <string>
 #include <vector>
+#include "Difficulty.hpp"
+#include "HudCache.hpp"
 
 enum class MenuOption {
     PLAY,
@@ -24,12 +25,6 @@ enum class MenuState {
     PLAYING
 };
 
-enum class Difficulty {
-    EASY = 1,
-    MEDIUM = 2,
-    HARD = 3
-};
-
 class Menu {
 public:
     Menu();
@@ -38,8 +33,19 @@ public:
     void handleInput(SDL_Event& event);
     void update();
     void render(SDL_Renderer* renderer);
+    // Textures cibles perdues : redessiner les couches statiques
+    void invalidateLayers();
+
+    // Abonnement du menu affiché aux meilleurs scores de ScoreManager
+    // (thread principal). Un menu de simulation sans affichage ne s'abonne
+    // pas : il ne touche à aucun état partagé.
+    void watchHighScores();
+    void unwatchHighScores();
 
     MenuState getState() const { return state; }
+    // Seul l'écran principal s'anime (halo et brillance du titre) : les
+    // autres ne changent qu'à l'appui d'une touche
+    bool isAnimated() const { return state == MenuState::MAIN_MENU; }
     void setState(MenuState newState) { state = newState; }
 
     bool shouldStartNewGame() const { return startNewGame; }
@@ -69,7 +75,26 @@ private:
     float titlePulse;
     float titlePulseSpeed;
 
-    void drawText(SDL_Renderer* renderer, const std::string& text, int x, int y,
+    // Couche statique de chaque écran, gardée en texture : redessinée quand
+    // la sélection (ou les meilleurs scores) change. Seuls le halo et la
+    // brillance du titre sont tracés à chaque frame.
+    HudWidget mainLayer;
+    HudWidget difficultyLayer;
+    HudWidget creditsLayer;
+    HudWidget highScoresLayer;
+
+    // Meilleurs scores (facile, moyen, difficile), recopiés à chaque
+    // notification de ScoreManager ; la révision sert de clé à la couche
+    int highScores[3];
+    int highScoresRevision;
+    bool watchingHighScores;
+    static void onHighScoresChanged(void* context);
+
+    void renderMainLayer(SDL_Renderer* renderer);
+    void renderDifficultyLayer(SDL_Renderer* renderer);
+    void renderCreditsLayer(SDL_Renderer* renderer);
+
+    void drawText(SDL_Renderer* renderer, const char* text, int x, int y,
                   int size, bool selected = false);
     void drawFilledRect(SDL_Renderer* renderer, int x, int y, int w, int h);
     void drawBorder(SDL_Renderer* renderer, int x, int y, int w, int h);
@@ -0,0 +1,56 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+#include <cstdint>
+
+// Compteurs matériels (Linux uniquement, via perf_event_open)
+// Si le PMU n'est pas accessible (machine virtuelle, perf_event_paranoid...),
+// on se rabat sur les compteurs logiciels du noyau.
+enum class PerfCounter {
+    INSTRUCTIONS,
+    CYCLES,
+    CACHE_MISSES,
+    BRANCH_MISSES,
+    TASK_CLOCK,   // Logiciel : temps CPU en nanosecondes
+    PAGE_FAULTS,  // Logiciel
+    COUNT
+};
+
+struct PerfSample {
+    uint64_t values[static_cast<int>(PerfCounter::COUNT)];
+};
+
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    bool open();  // false si aucun compteur n'a pu être ouvert
+    void close();
+
+    bool isAvailable(PerfCounter counter) const;
+    bool hasHardwareCounters() const { return hardwareGroupFd >= 0; }
+
+    // Lecture de toutes les valeurs (0 pour les compteurs indisponibles)
+    void read(PerfSample& sample) const;
+
+private:
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    void openGroup(const PerfCounter* counters, int count,
+                   int& groupFd, PerfCounter* order, int& orderCount);
+    void readGroup(int groupFd, const PerfCounter* order, int orderCount,
+                   PerfSample& sample) const;
+
+    int fds[static_cast<int>(PerfCounter::COUNT)];
+    // Ordre des compteurs dans chaque groupe (lecture PERF_FORMAT_GROUP)
+    PerfCounter hardwareOrder[static_cast<int>(PerfCounter::COUNT)];
+    PerfCounter softwareOrder[static_cast<int>(PerfCounter::COUNT)];
+    int hardwareCount;
+    int softwareCount;
+    int hardwareGroupFd;
+    int softwareGroupFd;
+};
+
+#endif
@@ -2,8 +2,10 @@
 #define PLAYER_HPP
 
 #include "Vector2D.hpp"
-#include <SDL2/SDL.h>
-#include <deque>
+#include <cstdint>
+
+struct SDL_Renderer;
+struct PlayerSnapshot;
 
 enum class Direction {
     DOWN = 0,
@@ -21,8 +23,14 @@ public:
     Player(float x, float y);
     ~Player();
 
-    void handleInput();
-    void handleEvent(SDL_Event& event);
+    // Réinitialisation sur place (respawn) sans réallocation
+    void reset(float x, float y);
+
+    // heldKeys : masque InputKeys (clavier réel ou replay)
+    void handleInput(uint8_t heldKeys);
+    // Saut / attaque ; false si l'action est impossible dans l'état actuel
+    bool jump();
+    bool attack();
     void update();
     void render(SDL_Renderer* renderer);
 
@@ -34,8 +42,15 @@ public:
     bool getIsGrounded() const { return isGrounded; }
     void applyKnockback(const Vector2D& sourcePos);
     void blockMovementTowards(const Vector2D& obstaclePos, int obstacleRadius);
+    // Comme blockMovementTowards, mais sans pouvoir traverser l'obstacle
+    // pendant le déplacement depuis from (position en début de frame)
+    void blockSweptMovement(const Vector2D& from, const Vector2D& obstaclePos, int obstacleRadius);
     void setInvincible(bool invincible) { isInvincible = invincible; }
 
+    // Instantané de l'état dynamique (voir Snapshot.hpp)
+    void saveState(PlayerSnapshot& snapshot) const;
+    void loadState(const PlayerSnapshot& snapshot);
+
 private:
     void drawCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius);
     void drawFilledCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius);
@@ -73,8 +88,10 @@ private:
     Vector2D previousPosition;
 
     // Délai de réaction du satellite (historique de positions)
-    std::deque<Vector2D> positionHistory;
+    // Tampon circulaire de taille fixe : aucune allocation pendant le jeu
     static const int SATELLITE_DELAY_FRAMES = 15;  // 0.25 seconde à 60 FPS
+    Vector2D positionHistory[SATELLITE_DELAY_FRAMES];
+    int historyHead;  // Indice de la position la plus ancienne
 
     // Position de l'ombre au sol (mémorisée au début du saut)
     float shadowGroundY;
@@ -0,0 +1,112 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+
+// Flux aléatoires indépendants : chaque sous-système tire dans le sien,
+// un tirage de plus dans l'un ne décale pas les autres
+enum class RandomStream : uint64_t {
+    HOLES = 1,       // Génération des trous d'une salle
+    ENEMY_SPAWN = 2, // Positions d'apparition des ennemis
+    PATROL = 3,      // Cibles de patrouille (un flux par ennemi)
+    PARTICLES = 4,   // Particules de célébration
+    EPISODE = 5      // Graine de chaque partie de la simulation par lots
+};
+
+// Générateur xoshiro256** (Blackman & Vigna), initialisé par SplitMix64.
+// Pas d'état global : deux instances sur deux threads sont indépendantes.
+class Random {
+public:
+    Random() { seed(0); }
+    explicit Random(uint64_t seedValue) { seed(seedValue); }
+
+    void seed(uint64_t seedValue) {
+        // SplitMix64 garantit un état non nul même pour une graine nulle
+        uint64_t x = seedValue;
+        for (int i = 0; i < 4; i++) {
+            state[i] = splitMix64(x);
+        }
+    }
+
+    uint64_t next() {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+
+        return result;
+    }
+
+    // État brut (instantanés de partie)
+    void getState(uint64_t out[4]) const {
+        for (int i = 0; i < 4; i++) out[i] = state[i];
+    }
+
+    void setState(const uint64_t in[4]) {
+        for (int i = 0; i < 4; i++) state[i] = in[i];
+    }
+
+    // Entier dans [0, bound) (méthode de Lemire, sans division dans le cas courant)
+    int nextInt(int bound) {
+        if (bound <= 0) return 0;
+        uint32_t range = static_cast<uint32_t>(bound);
+        uint64_t m = static_cast<uint64_t>(static_cast<uint32_t>(next() >> 32)) * range;
+        uint32_t low = static_cast<uint32_t>(m);
+        if (low < range) {
+            uint32_t threshold = static_cast<uint32_t>(-range) % range;
+            while (low < threshold) {
+                m = static_cast<uint64_t>(static_cast<uint32_t>(next() >> 32)) * range;
+                low = static_cast<uint32_t>(m);
+            }
+        }
+        return static_cast<int>(m >> 32);
+    }
+
+    // Entier dans [minValue, maxValue)
+    int range(int minValue, int maxValue) {
+        return minValue + nextInt(maxValue - minValue);
+    }
+
+    // Réel dans [0, 1)
+    float nextFloat() {
+        return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f);
+    }
+
+    // Graine d'un flux, fonction uniquement de (graine de partie, flux, niveau,
+    // difficulté, indice) : un niveau se reproduit à l'identique, et les salles
+    // peuvent être générées en parallèle sans partager d'état
+    static uint64_t deriveSeed(uint64_t runSeed, RandomStream stream, int level, int difficulty, int index = 0) {
+        uint64_t x = runSeed;
+        uint64_t h = splitMix64(x);
+        h ^= static_cast<uint64_t>(stream) * 0x9E3779B97F4A7C15ULL;
+        x = h;
+        h = splitMix64(x) ^ static_cast<uint64_t>(static_cast<uint32_t>(level));
+        x = h;
+        h = splitMix64(x) ^ static_cast<uint64_t>(static_cast<uint32_t>(difficulty));
+        x = h;
+        h = splitMix64(x) ^ static_cast<uint64_t>(static_cast<uint32_t>(index));
+        x = h;
+        return splitMix64(x);
+    }
+
+private:
+    uint64_t state[4];
+
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+};
+
+#endif
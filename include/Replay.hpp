@@ -0,0 +1,68 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include "InputState.hpp"
+#include <cstdint>
+#include <fstream>
+
+// Format d'un fichier de replay (entiers en little-endian) :
+//   "ABRP", version (1 octet), graine de la partie (8 octets)
+//   puis : run { frame run } FIN
+//   run   : varint, nombre de frames identiques à la précédente sans événement
+//   frame : touches maintenues (1 octet), varint nombre d'événements,
+//           puis par événement : varint type, varint touche
+//   FIN   : octet 0xFF à la place des touches
+class InputRecorder {
+public:
+    InputRecorder();
+    ~InputRecorder();
+
+    bool open(const char* path, uint64_t seed);
+    void recordFrame(const InputFrame& frame);
+    void close();
+
+    bool isActive() const { return active; }
+    uint32_t getFrameCount() const { return frameCount; }
+
+private:
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    void writeVarint(uint32_t value);
+
+    std::ofstream file;
+    bool active;
+    uint8_t lastKeys;
+    uint32_t idleRun;
+    uint32_t frameCount;
+};
+
+class InputReplay {
+public:
+    InputReplay();
+
+    bool open(const char* path);
+
+    // Remplit la frame suivante ; false à la fin du replay
+    bool nextFrame(InputFrame& frame);
+    void close();
+
+    bool isActive() const { return active; }
+    uint64_t getSeed() const { return seed; }
+    uint32_t getFrameCount() const { return frameCount; }
+
+private:
+    InputReplay(const InputReplay&) = delete;
+    InputReplay& operator=(const InputReplay&) = delete;
+
+    bool readVarint(uint32_t& value);
+
+    std::ifstream file;
+    bool active;
+    uint64_t seed;
+    uint8_t lastKeys;
+    uint32_t idleRun;
+    uint32_t frameCount;
+};
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef REWINDBUFFER_HPP
+#define REWINDBUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Historique des dernières frames d'un état binaire de taille fixe
+// (typiquement un WorldSnapshot), dans un budget mémoire fixe.
+//
+// Chaque frame est stockée comme le XOR avec la frame précédente, compressé
+// par plages de zéros : d'une frame à l'autre, presque tous les octets sont
+// identiques. Une image clé (l'état complet, compressé de la même façon)
+// est ajoutée toutes les keyframeInterval frames pour accéder rapidement à
+// une frame ancienne. Le XOR étant symétrique, le même delta sert à reculer
+// et à avancer d'une frame.
+//
+// Les enregistrements sont écrits dans une arène circulaire ; les plus
+// anciens sont évincés quand le budget ou le nombre de frames est atteint.
+// Toute la mémoire est réservée à la construction : push() et stepBack()
+// n'allouent rien.
+class RewindBuffer {
+public:
+    RewindBuffer(size_t stateSize, int capacityFrames, int keyframeInterval, size_t budgetBytes);
+    ~RewindBuffer();
+
+    // Ajoute l'état de la frame courante
+    void push(const void* state);
+
+    // Recule d'une frame : retire la plus récente et écrit la précédente
+    // dans state. false si l'historique ne contient plus qu'une frame.
+    bool stepBack(void* state);
+
+    // Écrit dans state l'état d'il y a framesAgo frames (0 = la plus récente)
+    // sans modifier l'historique. false si cette frame n'est plus conservée.
+    bool peek(int framesAgo, void* state);
+
+    void clear();
+
+    int getFrameCount() const { return count; }
+    size_t getStateSize() const { return stateSize; }
+    // Octets occupés par les enregistrements conservés
+    size_t getMemoryUsed() const { return usedBytes; }
+    size_t getBudget() const { return arena.size(); }
+
+private:
+    RewindBuffer(const RewindBuffer&) = delete;
+    RewindBuffer& operator=(const RewindBuffer&) = delete;
+
+    struct Record {
+        uint32_t offset;     // Position dans l'arène
+        uint32_t deltaSize;  // XOR avec la frame précédente (0 pour la première)
+        uint32_t keySize;    // Image clé qui suit le delta (0 si absente)
+    };
+
+    // Encode (state XOR reference) ; reference nul = XOR avec des zéros
+    size_t encode(const uint8_t* state, const uint8_t* reference, uint8_t* out) const;
+    // state ^= données encodées
+    void applyXor(const uint8_t* data, size_t size, uint8_t* state) const;
+
+    uint8_t* allocate(size_t size);
+    void evictOldest();
+    Record& recordAt(int index) { return records[(head + index) % capacity]; }
+
+    size_t stateSize;
+    int capacity;
+    int keyframeInterval;
+
+    std::vector<uint8_t> arena;
+    size_t writePos;   // Prochaine écriture dans l'arène
+    size_t usedBytes;
+
+    std::vector<Record> records;  // Anneau : head = la plus ancienne
+    int head;
+    int count;
+    int framesSinceKey;
+
+    std::vector<uint8_t> current;  // État de la frame la plus récente
+    std::vector<uint8_t> scratch;  // Encodage avant copie dans l'arène
+};
+
+#endif
@@ -1,10 +1,16 @@
 #ifndef ROOM_HPP
 #define ROOM_HPP
 
-#include <SDL2/SDL.h>
 #include <vector>
+#include <cstdint>
 #include "Vector2D.hpp"
-#include "Menu.hpp"
+#include "Difficulty.hpp"
+#include "Random.hpp"
+#include "HazardSystem.hpp"
+
+struct SDL_Renderer;
+struct RoomSnapshot;
+struct HudCache;
 
 struct Hole {
     Vector2D position;
@@ -21,18 +27,31 @@ struct Particle {
 
 class Room {
 public:
-    Room(int screenWidth, int screenHeight, int level, Difficulty difficulty);
+    Room(int screenWidth, int screenHeight, int level, Difficulty difficulty, uint64_t runSeed);
     ~Room();
 
+    // Réinitialisation sur place pour un nouveau niveau : les tampons
+    // (trous, particules) sont réservés à la construction et réutilisés.
+    // La salle ne dépend que de (runSeed, level, difficulty).
+    void reset(int level, Difficulty difficulty, uint64_t runSeed);
+
     void update(float deltaTime);
     void render(SDL_Renderer* renderer);
-    void renderHUD(SDL_Renderer* renderer, int totalScore, float totalTime, int playerHealth, bool gameOver); // Afficher le score et le temps en premier plan
+    // Afficher le score et le temps en premier plan ; les éléments sont
+    // gardés en textures dans hud et redessinés quand leur valeur change
+    void renderHUD(SDL_Renderer* renderer, HudCache& hud, int totalScore, float totalTime, int playerHealth, bool gameOver);
     bool isPlayerInHole(const Vector2D& playerPos, int playerRadius) const;
+    // Version continue : premier instant t (0 = from, 1 = to) où le
+    // déplacement from -> to entre dans un trou
+    bool sweepHoles(const Vector2D& from, const Vector2D& to, int playerRadius, float& t) const;
     bool hasReachedEnd(const Vector2D& playerPos) const;
-    bool isPlayerTouchingElectricStar(const Vector2D& playerPos, int playerRadius) const;
+    // Étoiles électriques de la salle (blocage et dégâts : voir World::update)
+    const HazardSystem& getHazards() const { return hazards; }
     Vector2D getElectricStarPos() const { return electricStarPos; }
     int getElectricStarRadius() const { return electricStarRadius; }
-    Vector2D getSatelliteStarPos() const { return satelliteStarPos; }
+    Vector2D getSatelliteStarPos() const {
+        return satelliteHazard >= 0 ? hazards.getPosition(satelliteHazard) : Vector2D(0, 0);
+    }
     Difficulty getDifficulty() const { return difficulty; }
 
     void startTimer();
@@ -40,8 +59,15 @@ public:
     int getScore() const;
     float getElapsedTime() const { return elapsedTime; }
     bool isCelebrating() const { return celebrating; }
+    const std::vector<Hole>& getHoles() const { return holes; }
     void createCelebrationParticles(const Vector2D& position);
 
+    // Instantané de l'état dynamique (voir Snapshot.hpp) ; false si la salle
+    // dépasse les capacités de l'instantané. loadState attend un instantané
+    // déjà vérifié par validateSnapshot (nombres de trous et de particules).
+    bool saveState(RoomSnapshot& snapshot) const;
+    void loadState(const RoomSnapshot& snapshot);
+
 private:
     int screenWidth;
     int screenHeight;
@@ -49,7 +75,16 @@ private:
     Difficulty difficulty;
 
     std::vector<Hole> holes;
+    // Copie des trous en structure de tableaux pour les tests par lots
+    // (VectorBatch), tenue à jour avec holes
+    std::vector<float> holeX;
+    std::vector<float> holeY;
+    std::vector<float> holeRadii;
     std::vector<Particle> particles;
+
+    // Flux aléatoires propres à la salle
+    Random holeRandom;
+    Random particleRandom;
     int endZoneX;  // Zone à atteindre à droite
     int holeRadius;
 
@@ -65,21 +100,25 @@ private:
     // Étoile électrique au centre
     Vector2D electricStarPos;
     int electricStarRadius;
-    float electricAnimPhase;
-    std::vector<float> boltAngles;  // Angles des éclairs
+    float electricAnimPhase;  // Tracé : StarSpriteSheet
 
     // Étoile électrique satellite (mode difficile uniquement)
-    Vector2D satelliteStarPos;
-    float satelliteOrbitAngle;
     float satelliteOrbitSpeed;
     float satelliteOrbitRadius;
 
+    // Toutes les étoiles de la salle : la centrale, puis la satellite
+    HazardSystem hazards;
+    int satelliteHazard;  // Indice dans hazards, -1 hors mode difficile
+
+    static const int CELEBRATION_PARTICLES = 50;
+
+    int maxHoleCount() const;
     void generateHoles();
-    void drawElectricStar(SDL_Renderer* renderer);
+    void addHole(const Vector2D& position, int radius);
     void drawArrow(SDL_Renderer* renderer, int x, int y, int size);
     void drawNumber(SDL_Renderer* renderer, int number, int x, int y, int size);
     void drawHeart(SDL_Renderer* renderer, int x, int y, int size, int quarters);
-    void drawText(SDL_Renderer* renderer, const std::string& text, int x, int y, int size);
+    void drawText(SDL_Renderer* renderer, const char* text, int x, int y, int size);
 };
 
 #endif
@@ -0,0 +1,51 @@
+#ifndef ROOMBUILDER_HPP
+#define ROOMBUILDER_HPP
+
+#include "Difficulty.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+class Room;
+
+// Préparation d'une salle sur un thread de travail permanent.
+// Le thread est créé une seule fois : lancer une préparation n'alloue rien.
+class RoomBuilder {
+public:
+    RoomBuilder();
+    ~RoomBuilder();
+
+    void start();
+    void stop();
+
+    // Lance room->reset(level, difficulty, runSeed) en arrière-plan.
+    // La salle ne doit plus être utilisée par l'appelant avant wait().
+    void request(Room* room, int level, Difficulty difficulty, uint64_t runSeed);
+
+    // Attend la fin de la préparation en cours (immédiat si déjà terminée)
+    void wait();
+
+    bool isBusy();
+
+private:
+    RoomBuilder(const RoomBuilder&) = delete;
+    RoomBuilder& operator=(const RoomBuilder&) = delete;
+
+    void run();
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wakeWorker;
+    std::condition_variable jobDone;
+
+    // Travail demandé (protégé par mutex)
+    Room* pendingRoom;
+    int pendingLevel;
+    Difficulty pendingDifficulty;
+    uint64_t pendingSeed;
+    bool busy;
+    bool stopping;
+};
+
+#endif
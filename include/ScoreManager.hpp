@@ -2,12 +2,31 @@
 #define SCOREMANAGER_HPP
 
 #include <string>
+#include <vector>
 #include "Menu.hpp"
 
+// Score final annoncé pour une partie
+struct ScoreRecord {
+    int score;
+    Difficulty difficulty;
+};
+
+// Prévenu à chaque changement des meilleurs scores (chargement, nouveau record)
+typedef void (*ScoreListener)(void* context);
+
+// Meilleurs scores et abonnés : thread principal seulement (sans verrou).
 class ScoreManager {
 public:
     static ScoreManager& getInstance();
 
+    void addListener(ScoreListener listener, void* context);
+    void removeListener(ScoreListener listener, void* context);
+
+    // Liste de scores annoncés (une ligne "score difficulté" par partie).
+    // Sans état partagé : utilisable depuis plusieurs threads.
+    static bool saveRecords(const std::string& path, const std::vector<ScoreRecord>& records);
+    static bool loadRecords(const std::string& path, std::vector<ScoreRecord>& records);
+
     bool loadHighScore();
     void saveHighScore(int score, Difficulty difficulty);
     int getHighScore(Difficulty difficulty) const;
@@ -20,6 +39,13 @@ private:
     ScoreManager& operator=(const ScoreManager&) = delete;
 
     std::string getScoreFilePath() const;
+    void notifyListeners();
+
+    struct ListenerEntry {
+        ScoreListener listener;
+        void* context;
+    };
+    std::vector<ListenerEntry> listeners;
 
     int highScoreEasy;
     int highScoreMedium;
@@ -0,0 +1,42 @@
+#ifndef SIMMATH_HPP
+#define SIMMATH_HPP
+
+#include <cmath>
+#include "Fixed.hpp"
+
+// Réels du chemin de simulation (physique du joueur, des ennemis, orbite de
+// l'étoile satellite). Par défaut des flottants ; avec
+// AMAZING_BALL_FIXED_POINT (make FIXED_POINT=1), du Q16.16 et des tables
+// trigonométriques : les replays donnent alors le même résultat au bit près
+// sur toutes les machines et pour toutes les options de compilation.
+// L'état reste stocké en float (instantanés, rendu) ; seuls les calculs
+// passent par SimReal, et la conversion Q16.16 <-> float est exacte ou
+// arrondie de façon déterministe.
+#ifdef AMAZING_BALL_FIXED_POINT
+
+using SimReal = Fixed;
+
+inline float simFloat(SimReal value) { return value.toFloat(); }
+inline SimReal simSqrt(SimReal value) { return Fixed::sqrt(value); }
+inline SimReal simSin(SimReal angle) { return Fixed::sin(angle); }
+inline SimReal simCos(SimReal angle) { return Fixed::cos(angle); }
+inline SimReal simHypot(SimReal x, SimReal y) { return Fixed::hypot(x, y); }
+
+#else
+
+using SimReal = float;
+
+inline float simFloat(SimReal value) { return value; }
+inline SimReal simSqrt(SimReal value) { return std::sqrt(value); }
+inline SimReal simSin(SimReal angle) { return std::sin(angle); }
+inline SimReal simCos(SimReal angle) { return std::cos(angle); }
+inline SimReal simHypot(SimReal x, SimReal y) { return std::sqrt(x * x + y * y); }
+
+#endif
+
+// Longueur d'un vecteur (dx, dy) calculée dans l'arithmétique de simulation
+inline float simLength(float dx, float dy) {
+    return simFloat(simHypot(SimReal(dx), SimReal(dy)));
+}
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include <cstdint>
+#include "InputState.hpp"
+#include "Menu.hpp"
+#include "RewindBuffer.hpp"
+#include "Snapshot.hpp"
+#include "World.hpp"
+
+class RoomBuilder;
+
+// Effets d'une frame appliqués par l'hôte (Game ou validateur) :
+// la simulation ne touche ni à l'audio, ni au disque, ni à l'affichage
+struct SimulationEvents {
+    bool newGame;     // Une partie vient de commencer
+    bool backToMenu;  // Retour au menu pendant la partie
+    bool quit;
+    bool jumped;
+    bool attacked;
+    bool stateSaved;  // Sauvegarde rapide (F5)
+    bool stateLoaded; // Chargement rapide (F9)
+    bool rewinding;   // Retour en arrière d'une frame
+    bool gameOver;    // La partie vient de se terminer
+    int finalScore;   // Score total de la partie terminée
+
+    void clear() {
+        newGame = false;
+        backToMenu = false;
+        quit = false;
+        jumped = false;
+        attacked = false;
+        stateSaved = false;
+        stateLoaded = false;
+        rewinding = false;
+        gameOver = false;
+        finalScore = 0;
+    }
+};
+
+// Session de jeu pilotée par les entrées clavier : le menu et la partie
+// (World). Aucun état partagé : plusieurs instances peuvent tourner en
+// parallèle sur des threads différents.
+class Simulation {
+public:
+    Simulation(int width, int height);
+    ~Simulation();
+
+    // Graine fixe pour toutes les parties (sinon une graine est tirée à chaque partie)
+    void setSeed(uint64_t seed);
+    bool hasFixedSeed() const { return fixedSeed; }
+    uint64_t getRunSeed() const { return world.getRunSeed(); }
+    static uint64_t makeRunSeed();
+
+    // Préparation de la salle suivante en arrière-plan (sinon synchrone)
+    void setRoomBuilder(RoomBuilder* builder) { world.setRoomBuilder(builder); }
+
+    // Une frame (1/60 s) : événements puis mise à jour
+    void processEvents(const InputFrame& input, SimulationEvents& events);
+    void update(const InputFrame& input, SimulationEvents& events);
+    void step(const InputFrame& input, SimulationEvents& events) {
+        processEvents(input, events);
+        update(input, events);
+    }
+
+    // Partie en cours dans une salle : les frames ne doivent pas allouer
+    bool isSteadyGameplay() const { return gameStarted && world.isInRoom() && !world.isGameOver(); }
+
+    bool isGameStarted() const { return gameStarted; }
+
+    // Emplacement de sauvegarde rapide, gardé sur disque par le jeu entre
+    // deux sessions. restoreQuickSave le remplit avec une sauvegarde lue au
+    // démarrage (false si elle ne passe pas validateSnapshot).
+    const WorldSnapshot* getQuickSave() const { return hasQuickSave ? &quickSave : nullptr; }
+    bool restoreQuickSave(const WorldSnapshot& snapshot);
+    Difficulty getDifficulty() const { return menu.getDifficulty(); }
+
+    Menu& getMenu() { return menu; }
+    World& getWorld() { return world; }
+
+private:
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    void processEvent(SDL_Event& event, SimulationEvents& events);
+
+    Menu menu;
+    World world;
+    bool gameStarted;
+
+    // Sauvegarde rapide (F5 / F9), gardée d'une partie à l'autre ; passe par
+    // les événements clavier, donc un replay la reproduit à l'identique tant
+    // que l'emplacement part vide
+    WorldSnapshot quickSave;
+    bool hasQuickSave;
+
+    // Dernières secondes de jeu, rejouées à l'envers tant que la touche de
+    // retour en arrière est maintenue
+    static const int REWIND_SECONDS = 30;
+    static const int REWIND_KEYFRAME_INTERVAL = 60;          // Une image clé par seconde
+    static const size_t REWIND_BUDGET = 4 * 1024 * 1024;     // 4 Mo
+    RewindBuffer rewindBuffer;
+    WorldSnapshot rewindFrame;
+
+    uint64_t seed;
+    bool fixedSeed;
+};
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include "Vector2D.hpp"
+#include "Room.hpp"
+
+// Instantané binaire de l'état complet d'une partie.
+// Structures plates de taille fixe, sans pointeur : une sauvegarde ou une
+// restauration est une suite de copies mémoire, sans allocation.
+// Le format n'est valable que pour une même version du jeu (même
+// compilateur, même boutisme) : c'est une image mémoire, pas un format
+// d'échange.
+
+namespace SnapshotLimits {
+    // Trous d'une salle : 136 au plus tiennent dans une salle 800x600
+    // (voir Room::maxHoleCount)
+    const int MAX_HOLES = 160;
+    const int MAX_PARTICLES = 64;
+    const int MAX_ENEMIES = 4;
+    const int PLAYER_HISTORY = 15;
+}
+
+struct RandomSnapshot {
+    uint64_t state[4];
+};
+
+struct PlayerSnapshot {
+    Vector2D position;
+    Vector2D velocity;
+    Vector2D previousPosition;
+    Vector2D knockbackVelocity;
+    Vector2D positionHistory[SnapshotLimits::PLAYER_HISTORY];
+    int32_t direction;
+    int32_t historyHead;
+    int32_t knockbackFrames;
+    int32_t attackTimer;
+    float verticalVelocity;
+    float groundLevel;
+    float haloPhase;
+    float satelliteFloatPhase;
+    float satelliteLagX;
+    float satelliteLagY;
+    float shadowGroundY;
+    uint8_t isJumping;
+    uint8_t isGrounded;
+    uint8_t attacking;
+    uint8_t isInvincible;
+};
+
+struct EnemySnapshot {
+    Vector2D position;
+    Vector2D velocity;
+    Vector2D patrolTarget;
+    Vector2D knockbackVelocity;
+    Vector2D blockedStep;
+    RandomSnapshot patrolRandom;
+    int32_t state;
+    int32_t health;
+    int32_t knockbackFrames;
+    int32_t nextThinkTick;
+    int32_t coastFrames;
+    float animationPhase;
+    uint8_t thinkDeferrable;
+    uint8_t chaseBlocked;
+};
+
+struct RoomSnapshot {
+    RandomSnapshot holeRandom;
+    RandomSnapshot particleRandom;
+    int32_t level;
+    int32_t difficulty;
+    int32_t holeCount;
+    int32_t particleCount;
+    float elapsedTime;
+    float celebrationTime;
+    float arrowAnimPhase;
+    float electricAnimPhase;
+    int32_t satelliteHazard;
+    uint8_t timerRunning;
+    uint8_t celebrating;
+    Hole holes[SnapshotLimits::MAX_HOLES];
+    Particle particles[SnapshotLimits::MAX_PARTICLES];
+    HazardArrays hazards;
+};
+
+struct WorldSnapshot {
+    static const uint32_t MAGIC = 0x53534241;  // "ABSS"
+    static const uint32_t VERSION = 4;
+
+    uint32_t magic;
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    uint64_t runSeed;
+    int32_t difficulty;
+    int32_t currentLevel;
+    int32_t totalScore;
+    float totalTime;
+    int32_t playerLives;
+    int32_t playerHealth;
+    int32_t invincibilityFrames;
+    float celebrationTimer;
+    int32_t enemyCount;
+    uint8_t inRoom;
+    uint8_t gameOver;
+    uint8_t timerStarted;
+    uint8_t hasRoom;
+    int32_t aiTick;  // Horloge des scripts d'ennemis (voir AiScheduler)
+
+    PlayerSnapshot player;
+    RoomSnapshot room;
+    EnemySnapshot enemies[SnapshotLimits::MAX_ENEMIES];
+};
+
+static_assert(std::is_trivially_copyable<WorldSnapshot>::value,
+              "WorldSnapshot doit rester copiable par memcpy");
+
+// Vérifie tout ce qui sert d'indice, de taille ou d'énumération (nombres de
+// trous, de particules, de dangers, d'ennemis, difficultés, directions...)
+// avant qu'une restauration ne touche l'état courant : un fichier tronqué ou
+// corrompu est refusé au lieu de lire hors des tableaux.
+bool validateSnapshot(const WorldSnapshot& snapshot);
+
+// Sauvegarde sur disque (image brute de la structure, précédée de sa taille).
+// readSnapshotFile refuse un instantané qui ne passe pas validateSnapshot.
+bool writeSnapshotFile(const char* path, const WorldSnapshot& snapshot);
+bool readSnapshotFile(const char* path, WorldSnapshot& snapshot);
+
+#endif
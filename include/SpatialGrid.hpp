@@ -0,0 +1,60 @@
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include <cstdint>
+#include <vector>
+
+// Grille uniforme pour la phase large des collisions : chaque objet (cercle)
+// est rangé dans les cellules que couvre sa boîte englobante, et une requête
+// ne regarde que les cellules de la zone demandée. Le coût reste quasi
+// linéaire quel que soit le nombre d'objets.
+//
+// Reconstruite entièrement à chaque frame (tri par comptage, stable) :
+// dans une cellule, les indices sont croissants. Les tampons sont
+// dimensionnés à la construction pour maxObjects objets de rayon au plus
+// maxRadius : une frame de jeu n'alloue pas. Au-delà, ils grandissent à
+// la demande.
+class SpatialGrid {
+public:
+    SpatialGrid(float width, float height, float cellSize, int maxObjects, float maxRadius);
+    ~SpatialGrid();
+
+    // Range count cercles (tableaux x, y, rayon) ; les indices renvoyés par
+    // query sont les positions dans ces tableaux
+    void build(int count, const float* x, const float* y, const float* radius);
+
+    // Indices des objets dont la boîte touche le rectangle, sans doublon et
+    // dans l'ordre croissant ; renvoie le nombre écrit (au plus maxOut)
+    int query(float minX, float minY, float maxX, float maxY, int* out, int maxOut) const;
+
+    // Même résultat dans l'ordre de parcours des cellules (déterministe pour
+    // des positions données) : évite le tri quand l'ordre importe peu
+    int queryUnsorted(float minX, float minY, float maxX, float maxY, int* out, int maxOut) const;
+
+    // Raccourci : objets proches d'un cercle
+    int queryCircle(float x, float y, float radius, int* out, int maxOut) const {
+        return query(x - radius, y - radius, x + radius, y + radius, out, maxOut);
+    }
+
+private:
+    int cellX(float x) const;
+    int cellY(float y) const;
+
+    float cellSize;
+    float inverseCellSize;
+    int columns;
+    int rows;
+
+    std::vector<int> cellStart;   // Début de chaque cellule dans items (+ fin)
+    std::vector<int> items;       // Indices d'objets, regroupés par cellule
+    std::vector<int> cellCursor;  // Tampon de remplissage
+
+    // Boîte de chaque objet en cellules, mémorisée entre les deux passes
+    std::vector<int16_t> boxes;
+
+    // Marquage des objets déjà rendus par la requête en cours
+    mutable std::vector<uint32_t> stamps;
+    mutable uint32_t currentStamp;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef STARSPRITESHEET_HPP
+#define STARSPRITESHEET_HPP
+
+#include <map>
+
+struct SDL_Renderer;
+struct SDL_Texture;
+
+// Animation de l'étoile électrique précalculée en planche d'images : une
+// texture par rayon, FRAME_COUNT phases réparties sur le cycle [0, 2 pi) de
+// electricAnimPhase. Chaque planche est dessinée une seule fois par
+// processus, à la première étoile de ce rayon ; une étoile coûte ensuite une
+// copie de texture par frame au lieu du tracé complet.
+namespace StarSheetLayout {
+    const int FRAME_COUNT = 48;   // ~1 phase par frame à 60 FPS (8 rad/s)
+    const int COLUMNS = 8;
+}
+
+class StarSpriteSheet {
+public:
+    static StarSpriteSheet& getInstance();
+
+    // Libère les textures ; à appeler avant de détruire le renderer
+    void cleanup();
+
+    // Dessine l'étoile de centre (centerX, centerY) à la phase donnée, avec
+    // la planche de ce rayon (créée au premier appel). Si la planche ne peut
+    // pas être créée, l'étoile est tracée directement.
+    void draw(SDL_Renderer* renderer, int centerX, int centerY, int radius, float phase);
+
+    // Tracé complet d'une étoile (sert à remplir les planches)
+    static void drawStar(SDL_Renderer* renderer, int centerX, int centerY, int radius, float phase);
+
+private:
+    StarSpriteSheet();
+    ~StarSpriteSheet();
+    StarSpriteSheet(const StarSpriteSheet&) = delete;
+    StarSpriteSheet& operator=(const StarSpriteSheet&) = delete;
+
+    struct Sheet {
+        SDL_Texture* texture;   // nullptr : création impossible, tracé direct
+        int cellSize;           // Côté d'une case, l'étoile centrée dedans
+    };
+
+    std::map<int, Sheet> sheets;  // Par rayon
+
+    Sheet buildSheet(SDL_Renderer* renderer, int radius);
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef TIMINGWHEEL_HPP
+#define TIMINGWHEEL_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace WheelLimits {
+    // 4 niveaux de 64 cases : échéances jusqu'à 2^24 frames (plus de 77
+    // heures à 60 FPS) sans passer par la liste de débordement
+    const int LEVEL_BITS = 6;
+    const int SLOTS_PER_LEVEL = 1 << LEVEL_BITS;
+    const int LEVELS = 4;
+}
+
+// Référence vers un minuteur programmé ; périmée une fois qu'il a expiré
+// ou qu'il a été annulé
+struct TimerHandle {
+    int32_t entry;
+    uint32_t generation;
+};
+
+// Roue temporelle hiérarchique pour les échéances en frames.
+// Programmer et annuler coûtent O(1). Avancer d'une frame ne coûte que les
+// minuteurs qui expirent, plus leurs descentes d'un niveau à l'autre (au
+// plus LEVELS par minuteur sur toute sa vie) : les minuteurs qui attendent
+// ne sont jamais parcourus.
+//
+// Un minuteur du niveau L partage avec la frame courante tous les bits
+// au-dessus de son niveau. Quand la frame courante franchit un multiple de
+// 64^L, la case correspondante du niveau L est redistribuée vers les niveaux
+// inférieurs.
+class TimingWheel {
+public:
+    static const int32_t NO_ENTRY = -1;
+
+    explicit TimingWheel(int expectedTimers);
+    ~TimingWheel();
+
+    // Vide la roue et place l'horloge sur cette frame
+    void reset(int32_t tick);
+    int32_t getTick() const { return currentTick; }
+    int getActiveCount() const { return activeCount; }
+
+    // Programme une échéance ; une frame déjà passée expire à la frame
+    // suivante. payload et tick sont rendus tels quels à l'expiration.
+    TimerHandle schedule(int32_t tick, uint32_t payload);
+
+    // Sans effet si le minuteur a déjà expiré ou été annulé
+    bool cancel(TimerHandle handle);
+
+    static TimerHandle none() { TimerHandle handle = { NO_ENTRY, 0 }; return handle; }
+
+    // Avance d'une frame et appelle onExpire(payload, tick) pour chaque
+    // minuteur échu, dans l'ordre de programmation. Le rappel peut
+    // programmer ou annuler d'autres minuteurs.
+    template <typename Callback>
+    void advance(Callback&& onExpire) {
+        currentTick++;
+        cascade();
+
+        int slot = static_cast<int>(static_cast<uint32_t>(currentTick) & SLOT_MASK);
+        int32_t index;
+        while ((index = heads[slot]) != NO_ENTRY) {
+            Entry& entry = entries[index];
+            uint32_t payload = entry.payload;
+            int32_t tick = entry.tick;
+            unlink(index);
+            release(index);
+            onExpire(payload, tick);
+        }
+    }
+
+private:
+    static const uint32_t SLOT_MASK = WheelLimits::SLOTS_PER_LEVEL - 1;
+    // Case des échéances au-delà du dernier niveau
+    static const int OVERFLOW_SLOT = WheelLimits::LEVELS * WheelLimits::SLOTS_PER_LEVEL;
+    static const int SLOT_COUNT = OVERFLOW_SLOT + 1;
+
+    struct Entry {
+        int32_t tick;        // Échéance demandée
+        int32_t due;         // Échéance effective (jamais avant la frame suivante)
+        uint32_t payload;
+        uint32_t generation;
+        int32_t slot;        // Case qui le contient, NO_ENTRY s'il est libre
+        int32_t prev;
+        int32_t next;        // Aussi chaînage de la liste libre
+    };
+
+    int slotFor(int32_t due) const;
+    void insert(int32_t index);
+    void unlink(int32_t index);
+    void release(int32_t index);
+    void cascade();
+    void redistribute(int slot);
+
+    std::vector<Entry> entries;
+    int32_t heads[SLOT_COUNT];
+    int32_t tails[SLOT_COUNT];
+    int32_t freeList;
+    int32_t currentTick;
+    int activeCount;
+};
+
+#endif
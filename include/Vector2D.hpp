@@ -1,36 +1,65 @@
 #ifndef VECTOR2D_HPP
 #define VECTOR2D_HPP
 
+// Opérations constexpr : utilisables dans des constantes calculées à la
+// compilation. Les longueurs passent par simLength (SimMath.hpp) pour rester
+// dans l'arithmétique de simulation ; les traitements par lots sont dans
+// VectorBatch.hpp.
 class Vector2D {
 public:
     float x;
     float y;
 
-    Vector2D() : x(0), y(0) {}
-    Vector2D(float x, float y) : x(x), y(y) {}
+    constexpr Vector2D() : x(0), y(0) {}
+    constexpr Vector2D(float x, float y) : x(x), y(y) {}
 
-    Vector2D operator+(const Vector2D& v) const {
+    constexpr Vector2D operator+(const Vector2D& v) const {
         return Vector2D(x + v.x, y + v.y);
     }
 
-    Vector2D operator-(const Vector2D& v) const {
+    constexpr Vector2D operator-(const Vector2D& v) const {
         return Vector2D(x - v.x, y - v.y);
     }
 
-    Vector2D operator*(float scalar) const {
+    constexpr Vector2D operator*(float scalar) const {
         return Vector2D(x * scalar, y * scalar);
     }
 
-    Vector2D& operator+=(const Vector2D& v) {
+    constexpr Vector2D& operator+=(const Vector2D& v) {
         x += v.x;
         y += v.y;
         return *this;
     }
 
-    void zero() {
+    constexpr Vector2D& operator-=(const Vector2D& v) {
+        x -= v.x;
+        y -= v.y;
+        return *this;
+    }
+
+    constexpr Vector2D& operator*=(float scalar) {
+        x *= scalar;
+        y *= scalar;
+        return *this;
+    }
+
+    constexpr float dot(const Vector2D& v) const {
+        return x * v.x + y * v.y;
+    }
+
+    // Comparer des carrés évite la racine (mêmes opérations que dx*dx + dy*dy)
+    constexpr float lengthSquared() const {
+        return x * x + y * y;
+    }
+
+    constexpr void zero() {
         x = 0;
         y = 0;
     }
 };
 
+constexpr float distanceSquared(const Vector2D& a, const Vector2D& b) {
+    return (b - a).lengthSquared();
+}
+
 #endif
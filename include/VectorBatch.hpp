@@ -0,0 +1,39 @@
+#ifndef VECTORBATCH_HPP
+#define VECTORBATCH_HPP
+
+// Calculs de vecteurs par lots sur des tableaux de coordonnées (structure de
+// tableaux : x[i], y[i]). Selon les options de compilation, 8 éléments par
+// instruction (AVX, make AVX=1), 4 (SSE2, par défaut sur x86-64) ou un
+// (version scalaire, autres processeurs).
+//
+// Toutes les versions font les mêmes opérations dans le même ordre, sans
+// FMA, avec racine et division arrondies au plus près : le résultat est le
+// même au bit près que le code scalaire équivalent, quel que soit le jeu
+// d'instructions. Les parties restent donc rejouables d'une machine à
+// l'autre.
+namespace VectorBatch {
+
+// Jeu d'instructions retenu à la compilation ("AVX", "SSE2" ou "scalaire")
+const char* instructionSet();
+
+// out[i] = (x[i] - px)² + (y[i] - py)²
+void distanceSquared(float px, float py, const float* x, const float* y, int count, float* out);
+
+// Normalise chaque (x[i], y[i]) sur place ; un vecteur nul reste nul. Avec
+// AMAZING_BALL_FIXED_POINT, la longueur est celle de simLength (scalaire).
+void normalize(float* x, float* y, int count);
+
+// Indices croissants des cercles (x[i], y[i], radii[i]) qui touchent le
+// cercle (cx, cy, radius), contact inclus : distance <= radius + radii[i].
+// S'arrête après maxOut indices ; renvoie leur nombre.
+int overlapCircle(float cx, float cy, float radius,
+                  const float* x, const float* y, const float* radii, int count,
+                  int* out, int maxOut);
+
+// Indice du point le plus proche de (px, py) (le plus petit en cas
+// d'égalité), -1 si count vaut 0. distanceSq reçoit le carré de sa distance.
+int nearest(float px, float py, const float* x, const float* y, int count, float* distanceSq);
+
+} // namespace VectorBatch
+
+#endif
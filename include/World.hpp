@@ -0,0 +1,137 @@
+#ifndef WORLD_HPP
+#define WORLD_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Difficulty.hpp"
+#include "Enemy.hpp"
+#include "SpatialGrid.hpp"
+#include "CrowdSteering.hpp"
+#include "AiScheduler.hpp"
+
+class Player;
+class Room;
+class RoomBuilder;
+struct WorldSnapshot;
+
+// Résultat d'une frame de jeu
+struct WorldEvents {
+    bool gameOver;   // La partie vient de se terminer
+    int finalScore;  // Score total de la partie terminée
+
+    void clear() {
+        gameOver = false;
+        finalScore = 0;
+    }
+};
+
+// Partie en cours : salle, joueur, ennemis et règles du jeu.
+// Ni SDL ni singleton : instanciable en grand nombre, sur plusieurs threads.
+class World {
+public:
+    static const int MAX_ENEMIES = 4;
+
+    World(int width, int height);
+    ~World();
+
+    // Préparation de la salle suivante en arrière-plan (sinon synchrone)
+    void setRoomBuilder(RoomBuilder* builder) { roomBuilder = builder; }
+
+    // Nouvelle partie ; la salle ne dépend que de (runSeed, level, difficulty)
+    void start(Difficulty difficulty, int level, uint64_t runSeed);
+
+    // Actions ponctuelles ; false si impossibles dans l'état actuel
+    bool jump();
+    bool attack();
+
+    // Une frame (1/60 s) avec les touches de déplacement maintenues (InputKeys)
+    void update(uint8_t heldKeys, WorldEvents& events);
+
+    // Budget d'IA par frame pour les ennemis éloignés (voir AiScheduler)
+    void setAiBudget(float microseconds) { aiScheduler.setBudget(microseconds); }
+    const AiScheduler& getAiScheduler() const { return aiScheduler; }
+
+    bool isInRoom() const { return inRoom && currentRoom; }
+    bool isGameOver() const { return gameOver; }
+    int getLevel() const { return currentLevel; }
+    Difficulty getDifficulty() const { return difficulty; }
+    uint64_t getRunSeed() const { return runSeed; }
+    int getTotalScore() const { return totalScore; }
+    float getTotalTime() const { return totalTime; }
+    int getPlayerHealth() const { return playerHealth; }
+
+    // Instantané complet de la partie, en quelques microsecondes et sans
+    // allocation. saveState échoue si la salle dépasse les capacités de
+    // l'instantané, loadState si l'instantané vient d'un monde d'une autre
+    // taille ou ne passe pas validateSnapshot (l'état courant est alors intact).
+    bool saveState(WorldSnapshot& snapshot) const;
+    bool loadState(const WorldSnapshot& snapshot);
+
+    Player& getPlayer() { return *player; }
+    const Player& getPlayer() const { return *player; }
+    Room* getRoom() { return currentRoom.get(); }
+    const Room* getRoom() const { return currentRoom.get(); }
+    std::vector<Enemy>& getEnemies() { return enemies; }
+    const std::vector<Enemy>& getEnemies() const { return enemies; }
+
+private:
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    void endGame(WorldEvents& events);
+    void spawnEnemies();
+    void recordEnemyStarts();
+    void buildEnemyBroadphase();
+    void applyPlayerAttack(const Vector2D& playerPos);
+
+    int width;
+    int height;
+
+    std::unique_ptr<Player> player;
+    // Stockage par valeur, capacité réservée une fois : pas d'allocation
+    // lors des changements de niveau
+    std::vector<Enemy> enemies;
+
+    // Phase large des ennemis (attaque et contacts), reconstruite à chaque
+    // frame : chaque ennemi y couvre son trajet depuis enemyStart
+    SpatialGrid enemyGrid;
+    std::vector<Vector2D> enemyStart;
+    std::vector<float> enemyBoundsX;
+    std::vector<float> enemyBoundsY;
+    std::vector<float> enemyBoundsRadius;
+    std::vector<int> nearbyEnemies;
+
+    // Séparation et évitement entre ennemis
+    CrowdSteering crowd;
+
+    // Cadence de réflexion des ennemis selon leur distance au joueur
+    AiScheduler aiScheduler;
+
+    std::unique_ptr<Room> currentRoom;
+
+    // Salle suivante, préparée pendant la célébration
+    std::unique_ptr<Room> nextRoom;
+    RoomBuilder* roomBuilder;
+    bool nextRoomRequested;
+
+    // Graine de la partie : salles et ennemis en dépendent uniquement
+    uint64_t runSeed;
+    Difficulty difficulty;
+
+    bool inRoom;
+    int currentLevel;
+    int totalScore;
+    float totalTime;
+    int playerLives;
+    int playerHealth; // Santé en quarts de cœur (4 = 1 cœur, 12 = 3 cœurs)
+    int invincibilityFrames; // Frames d'invincibilité après avoir pris un coup
+    static const int invincibilityDuration = 90; // 1.5 secondes à 60 FPS
+    bool gameOver;
+
+    // Chronométrage de la salle courante
+    bool timerStarted;       // Le joueur a quitté la zone de départ
+    float celebrationTimer;  // Temps écoulé depuis l'arrivée
+};
+
+#endif
@@ -0,0 +1,199 @@
+#include "AiScheduler.hpp"
+#include "Enemy.hpp"
+#include <algorithm>
+
+AiScheduler::AiScheduler(int expectedEnemies)
+    : pool(expectedEnemies),
+      budget(AiRates::DEFAULT_BUDGET_US),
+      timers(expectedEnemies),
+      urgentCount(0),
+      scheduledThinkCount(0),
+      deferredCount(0),
+      sleepingCount(0),
+      estimatedCost(0.0f) {
+    context.tick = 0;
+    context.room = nullptr;
+
+    slots.reserve(expectedEnemies);
+    // Au plus une surveillance valide par script, plus une inscrite par
+    // reprise (une par script et par frame) et par relance d'un script
+    // interrompu, avant que la frame suivante ne retire les périmées
+    watchers.reserve(3 * expectedEnemies);
+    urgent.reserve(expectedEnemies);
+    due.reserve(expectedEnemies);
+}
+
+AiScheduler::~AiScheduler() {}
+
+void AiScheduler::attach(std::vector<Enemy>& enemies) {
+    // Les anciens scripts libèrent leurs cadres avant les nouveaux
+    slots.clear();
+    timers.reset(context.tick);
+    watchers.clear();
+
+    int count = static_cast<int>(enemies.size());
+    slots.resize(count);
+    for (int i = 0; i < count; i++) {
+        slots[i].timer = TimingWheel::none();
+        slots[i].generation = 0;
+        slots[i].queuedTick = Behavior::NO_TICK;
+
+        // Réflexions des patrouilles lointaines décalées selon l'indice pour
+        // qu'elles ne tombent pas toutes sur la même frame
+        enemies[i].setThinkSlot(i);
+        enemies[i].consumeInterrupt();
+        restart(enemies, i);
+    }
+}
+
+void AiScheduler::restart(std::vector<Enemy>& enemies, int index) {
+    Slot& slot = slots[index];
+    slot.task.destroy();
+    slot.task = enemies[index].behave(pool, context);
+
+    // Amorçage : le script s'arrête sur sa première attente sans rien
+    // modifier, toutes ses attentes étant calculées à partir de l'ennemi
+    resume(index);
+}
+
+void AiScheduler::resume(int index) {
+    Slot& slot = slots[index];
+
+    // Réveillé par une autre condition : le réveil programmé n'a plus lieu d'être
+    timers.cancel(slot.timer);
+    slot.timer = TimingWheel::none();
+
+    if (!slot.task.resume()) {
+        // Script terminé (ennemi mort)
+        slot.task.destroy();
+        slot.generation++;
+        return;
+    }
+    sleep(index);
+}
+
+void AiScheduler::sleep(int index) {
+    Slot& slot = slots[index];
+    slot.generation++;
+
+    // Les surveillances déjà inscrites pour ce script deviennent périmées
+    const Behavior::WakeCondition& wake = slot.task.getWake();
+    if (wake.tick != Behavior::NO_TICK) {
+        slot.timer = timers.schedule(wake.tick, static_cast<uint32_t>(index));
+    }
+    if (wake.nearRadius > 0.0f || wake.farRadius > 0.0f || wake.waitPath) {
+        Watcher watcher = { index, slot.generation };
+        watchers.push_back(watcher);
+    }
+}
+
+void AiScheduler::update(std::vector<Enemy>& enemies, const Vector2D& playerPos, Room* room) {
+    context.playerPos = playerPos;
+    context.room = room;
+    const int32_t tick = context.tick + 1;
+
+    urgentCount = 0;
+    scheduledThinkCount = 0;
+    deferredCount = 0;
+    sleepingCount = 0;
+    estimatedCost = 0.0f;
+    urgent.clear();
+    due.clear();
+
+    int count = static_cast<int>(enemies.size());
+
+    // Ennemis touchés depuis la dernière frame : leur script dormait peut-être
+    // sur une autre condition, il repart de l'état de l'ennemi (son réveil
+    // est programmé avant que la roue n'avance)
+    for (int i = 0; i < count; i++) {
+        if (enemies[i].consumeInterrupt()) {
+            restart(enemies, i);
+        }
+    }
+
+    // Réveils programmés échus : seuls ceux-là sont parcourus
+    timers.advance([this, tick](uint32_t payload, int32_t wakeTick) {
+        int index = static_cast<int>(payload);
+        Slot& slot = slots[index];
+        slot.timer = TimingWheel::none();
+        slot.queuedTick = tick;
+        if (slot.task.getWake().deferrable) {
+            DueThink think = { wakeTick, index };
+            due.push_back(think);
+        } else {
+            urgent.push_back(index);
+        }
+    });
+    context.tick = timers.getTick();
+
+    // Conditions surveillées : joueur et chemin. Les entrées périmées (script
+    // repris depuis) sont retirées au passage.
+    size_t kept = 0;
+    for (size_t k = 0; k < watchers.size(); k++) {
+        Watcher watcher = watchers[k];
+        Slot& slot = slots[watcher.index];
+        if (slot.generation != watcher.generation) continue;
+        if (slot.queuedTick == tick) {
+            watchers[kept++] = watcher;
+            continue;
+        }
+
+        Enemy& enemy = enemies[watcher.index];
+        const Behavior::WakeCondition& wake = slot.task.getWake();
+        Vector2D position = enemy.getPosition();
+        float dx = playerPos.x - position.x;
+        float dy = playerPos.y - position.y;
+        float distanceSq = dx * dx + dy * dy;
+
+        bool fired = false;
+        if (wake.nearRadius > 0.0f && distanceSq < wake.nearRadius * wake.nearRadius) {
+            fired = true;
+        } else if (wake.farRadius > 0.0f && distanceSq > wake.farRadius * wake.farRadius) {
+            fired = true;
+        } else if (wake.waitPath && (tick + watcher.index) % AiRates::PATH_RECHECK_INTERVAL == 0) {
+            fired = enemy.isPathClear(wake.pathTarget, room);
+        }
+
+        if (fired) {
+            slot.queuedTick = tick;
+            urgent.push_back(watcher.index);
+        } else {
+            watchers[kept++] = watcher;
+        }
+    }
+    watchers.resize(kept);
+
+    // Réveils urgents : toujours servis, leur coût est prélevé en premier
+    std::sort(urgent.begin(), urgent.end());
+    for (int index : urgent) {
+        resume(index);
+        estimatedCost += AiRates::FULL_THINK_COST_US;
+        urgentCount++;
+    }
+
+    // Réflexions reportables : les plus en retard d'abord, puis par indice,
+    // tant que le budget le permet
+    std::sort(due.begin(), due.end(), [](const DueThink& a, const DueThink& b) {
+        return a.tick != b.tick ? a.tick < b.tick : a.index < b.index;
+    });
+    for (const DueThink& think : due) {
+        Slot& slot = slots[think.index];
+        if (estimatedCost + AiRates::PATROL_THINK_COST_US <= budget) {
+            resume(think.index);
+            estimatedCost += AiRates::PATROL_THINK_COST_US;
+            scheduledThinkCount++;
+        } else {
+            // Reportée : même frame d'échéance, donc prioritaire à la suivante
+            slot.queuedTick = Behavior::NO_TICK;
+            slot.timer = timers.schedule(think.tick, static_cast<uint32_t>(think.index));
+            deferredCount++;
+        }
+    }
+
+    // Scripts endormis : prolonger le dernier déplacement validé
+    for (int i = 0; i < count; i++) {
+        if (slots[i].queuedTick == tick || enemies[i].isDead()) continue;
+        enemies[i].drift();
+        sleepingCount++;
+    }
+}
@@ -0,0 +1,170 @@
+#include "AllocationTracker.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Compteurs par thread : types triviaux, utilisables depuis operator new
+thread_local AllocationStats threadCounters = {0, 0};
+thread_local AllocationStats frameStart = {0, 0};
+thread_local AllocationStats previousFrame = {0, 0};
+thread_local bool steadyFrame = false;
+#ifdef AMAZING_BALL_ALLOC_CHECK
+thread_local bool failing = false;
+#endif
+
+#ifdef AMAZING_BALL_TRACK_ALLOCATIONS
+void recordAllocation(std::size_t size) {
+    threadCounters.count++;
+    threadCounters.bytes += size;
+
+#ifdef AMAZING_BALL_ALLOC_CHECK
+    if (steadyFrame && !failing) {
+        // Échouer sur l'allocation elle-même : la pile d'appels désigne le coupable.
+        // fprintf n'utilise pas operator new, pas de récursion possible.
+        failing = true;
+        std::fprintf(stderr,
+                     "ALLOC_CHECK: allocation de %zu octets pendant une frame de jeu en régime permanent\n",
+                     size);
+        std::abort();
+    }
+#endif
+}
+
+void* allocate(std::size_t size) {
+    recordAllocation(size);
+    if (size == 0) {
+        size = 1;
+    }
+    void* ptr = std::malloc(size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* allocateAligned(std::size_t size, std::size_t alignment) {
+    recordAllocation(size);
+    // aligned_alloc exige une taille multiple de l'alignement
+    std::size_t rounded = ((size + alignment - 1) / alignment) * alignment;
+    if (rounded == 0) {
+        rounded = alignment;
+    }
+    void* ptr = std::aligned_alloc(alignment, rounded);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+#endif
+
+} // namespace
+
+AllocationStats AllocationTracker::threadStats() {
+    return threadCounters;
+}
+
+void AllocationTracker::beginFrame(bool steadyState) {
+    frameStart = threadCounters;
+    steadyFrame = steadyState;
+}
+
+void AllocationTracker::endFrame() {
+    previousFrame.count = threadCounters.count - frameStart.count;
+    previousFrame.bytes = threadCounters.bytes - frameStart.bytes;
+    steadyFrame = false;
+}
+
+void AllocationTracker::markTransition() {
+    steadyFrame = false;
+}
+
+AllocationStats AllocationTracker::lastFrame() {
+    return previousFrame;
+}
+
+bool AllocationTracker::isEnabled() {
+#ifdef AMAZING_BALL_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef AMAZING_BALL_TRACK_ALLOCATIONS
+
+// Remplacement des opérateurs globaux
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+#endif
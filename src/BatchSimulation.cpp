@@ -0,0 +1,230 @@
+#include "BatchSimulation.hpp"
+#include "Player.hpp"
+#include "Room.hpp"
+#include "Random.hpp"
+#include <algorithm>
+
+BatchSimulation::BatchSimulation(int envCount, int width, int height, int threadCount)
+    : envCount(envCount > 0 ? envCount : 1),
+      baseSeed(0),
+      generation(0),
+      pendingChunks(0),
+      stopping(false) {
+
+    worlds.reserve(this->envCount);
+    configs.reserve(this->envCount);
+    for (int i = 0; i < this->envCount; i++) {
+        worlds.push_back(std::make_unique<World>(width, height));
+        EnvConfig config;
+        config.difficulty = Difficulty::MEDIUM;
+        config.level = 1;
+        config.episode = 0;
+        configs.push_back(config);
+    }
+
+    actionBuffer.assign(this->envCount, 0);
+    observationBuffer.assign(static_cast<size_t>(this->envCount) * BatchObservation::SIZE, 0.0f);
+    scoreBuffer.assign(this->envCount, 0);
+    doneBuffer.assign(this->envCount, 0);
+    finalScoreBuffer.assign(this->envCount, 0);
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    chunkCount = std::max(1, std::min(threadCount, this->envCount));
+
+    for (int chunk = 1; chunk < chunkCount; chunk++) {
+        workers.emplace_back(&BatchSimulation::workerLoop, this, chunk);
+    }
+
+    reset(0);
+}
+
+BatchSimulation::~BatchSimulation() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void BatchSimulation::configure(int env, Difficulty difficulty, int level) {
+    if (env < 0 || env >= envCount) return;
+    configs[env].difficulty = difficulty;
+    configs[env].level = level > 0 ? level : 1;
+}
+
+void BatchSimulation::reset(uint64_t seed) {
+    baseSeed = seed;
+    for (int env = 0; env < envCount; env++) {
+        configs[env].episode = 0;
+        startEpisode(env);
+        actionBuffer[env] = 0;
+        doneBuffer[env] = 0;
+        finalScoreBuffer[env] = 0;
+        writeObservation(env);
+    }
+}
+
+void BatchSimulation::startEpisode(int env) {
+    EnvConfig& config = configs[env];
+    uint64_t episodeSeed = Random::deriveSeed(baseSeed, RandomStream::EPISODE, env,
+                                              static_cast<int>(config.difficulty),
+                                              static_cast<int>(config.episode));
+    config.episode++;
+    worlds[env]->start(config.difficulty, config.level, episodeSeed);
+}
+
+int BatchSimulation::chunkBegin(int chunk) const {
+    return static_cast<int>(static_cast<int64_t>(envCount) * chunk / chunkCount);
+}
+
+void BatchSimulation::step() {
+    if (chunkCount > 1) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pendingChunks = chunkCount - 1;
+            generation++;
+        }
+        wakeWorkers.notify_all();
+    }
+
+    // Le thread appelant traite le premier bloc pendant ce temps
+    stepRange(chunkBegin(0), chunkBegin(1));
+
+    if (chunkCount > 1) {
+        std::unique_lock<std::mutex> lock(mutex);
+        chunksDone.wait(lock, [this] { return pendingChunks == 0; });
+    }
+}
+
+void BatchSimulation::workerLoop(int chunk) {
+    uint64_t seenGeneration = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wakeWorkers.wait(lock, [this, seenGeneration] { return stopping || generation != seenGeneration; });
+        if (stopping) {
+            return;
+        }
+        seenGeneration = generation;
+
+        lock.unlock();
+        stepRange(chunkBegin(chunk), chunkBegin(chunk + 1));
+        lock.lock();
+
+        pendingChunks--;
+        if (pendingChunks == 0) {
+            chunksDone.notify_one();
+        }
+    }
+}
+
+void BatchSimulation::stepRange(int begin, int end) {
+    WorldEvents events;
+
+    for (int env = begin; env < end; env++) {
+        World& world = *worlds[env];
+        uint8_t action = actionBuffer[env];
+
+        // Actions ponctuelles d'abord, comme les événements clavier du jeu
+        if (action & BatchActions::JUMP) {
+            world.jump();
+        }
+        if (action & BatchActions::ATTACK) {
+            world.attack();
+        }
+
+        events.clear();
+        world.update(action & (InputKeys::UP | InputKeys::DOWN | InputKeys::LEFT | InputKeys::RIGHT), events);
+
+        doneBuffer[env] = events.gameOver ? 1 : 0;
+        if (events.gameOver) {
+            finalScoreBuffer[env] = events.finalScore;
+            startEpisode(env);
+        }
+
+        writeObservation(env);
+    }
+}
+
+void BatchSimulation::writeObservation(int env) {
+    const World& world = *worlds[env];
+    const Player& player = world.getPlayer();
+    const Room* room = world.getRoom();
+    float* obs = &observationBuffer[static_cast<size_t>(env) * BatchObservation::SIZE];
+
+    std::fill(obs, obs + BatchObservation::SIZE, 0.0f);
+
+    Vector2D playerPos = player.getPosition();
+    obs[BatchObservation::PLAYER_X] = playerPos.x;
+    obs[BatchObservation::PLAYER_Y] = playerPos.y;
+    obs[BatchObservation::PLAYER_GROUNDED] = player.getIsGrounded() ? 1.0f : 0.0f;
+    obs[BatchObservation::HEALTH] = static_cast<float>(world.getPlayerHealth());
+    obs[BatchObservation::LEVEL] = static_cast<float>(world.getLevel());
+
+    int roomScore = 0;
+    if (room) {
+        roomScore = room->getScore();
+        obs[BatchObservation::ROOM_SCORE] = static_cast<float>(roomScore);
+        obs[BatchObservation::ELAPSED] = room->getElapsedTime();
+        obs[BatchObservation::CELEBRATING] = room->isCelebrating() ? 1.0f : 0.0f;
+
+        Vector2D star = room->getElectricStarPos();
+        obs[BatchObservation::STAR_X] = star.x;
+        obs[BatchObservation::STAR_Y] = star.y;
+        if (room->getDifficulty() == Difficulty::HARD) {
+            Vector2D satellite = room->getSatelliteStarPos();
+            obs[BatchObservation::SATELLITE_X] = satellite.x;
+            obs[BatchObservation::SATELLITE_Y] = satellite.y;
+        }
+
+        // Trous les plus proches (sélection partielle, sans allocation)
+        const std::vector<Hole>& holes = room->getHoles();
+        float bestDistance[BatchObservation::NEAREST_HOLES];
+        int bestCount = 0;
+        for (const auto& hole : holes) {
+            float dx = hole.position.x - playerPos.x;
+            float dy = hole.position.y - playerPos.y;
+            float distance = dx * dx + dy * dy;
+
+            int slot = bestCount;
+            if (slot == BatchObservation::NEAREST_HOLES) {
+                if (distance >= bestDistance[slot - 1]) continue;
+                slot--;
+            } else {
+                bestCount++;
+            }
+            // Insertion triée
+            while (slot > 0 && bestDistance[slot - 1] > distance) {
+                bestDistance[slot] = bestDistance[slot - 1];
+                obs[BatchObservation::HOLES + slot * BatchObservation::HOLE_STRIDE] =
+                    obs[BatchObservation::HOLES + (slot - 1) * BatchObservation::HOLE_STRIDE];
+                obs[BatchObservation::HOLES + slot * BatchObservation::HOLE_STRIDE + 1] =
+                    obs[BatchObservation::HOLES + (slot - 1) * BatchObservation::HOLE_STRIDE + 1];
+                slot--;
+            }
+            bestDistance[slot] = distance;
+            obs[BatchObservation::HOLES + slot * BatchObservation::HOLE_STRIDE] = dx;
+            obs[BatchObservation::HOLES + slot * BatchObservation::HOLE_STRIDE + 1] = dy;
+        }
+    }
+
+    const std::vector<Enemy>& enemies = world.getEnemies();
+    int enemyCount = static_cast<int>(enemies.size());
+    if (enemyCount > World::MAX_ENEMIES) {
+        enemyCount = World::MAX_ENEMIES;
+    }
+    for (int i = 0; i < enemyCount; i++) {
+        float* enemyObs = obs + BatchObservation::ENEMIES + i * BatchObservation::ENEMY_STRIDE;
+        Vector2D enemyPos = enemies[i].getPosition();
+        enemyObs[0] = enemyPos.x;
+        enemyObs[1] = enemyPos.y;
+        enemyObs[2] = enemies[i].isDead() ? 0.0f : 1.0f;
+    }
+
+    scoreBuffer[env] = world.getTotalScore() + roomScore;
+}
@@ -0,0 +1,52 @@
+#include "Behavior.hpp"
+
+namespace Behavior {
+
+FramePool::FramePool(int blockCount)
+    : storage(nullptr),
+      freeList(nullptr),
+      heapFallbacks(0) {
+    if (blockCount <= 0) return;
+
+    // Un bloc = en-tête + cadre ; blocs chaînés par leur premier mot
+    storage = static_cast<unsigned char*>(::operator new(BLOCK_SIZE * blockCount));
+    for (int i = blockCount - 1; i >= 0; i--) {
+        void* block = storage + BLOCK_SIZE * i;
+        *static_cast<void**>(block) = freeList;
+        freeList = block;
+    }
+}
+
+FramePool::~FramePool() {
+    ::operator delete(storage);
+}
+
+void* FramePool::allocate(size_t size) {
+    unsigned char* block;
+    Header header;
+    if (freeList && size + sizeof(Header) <= BLOCK_SIZE) {
+        block = static_cast<unsigned char*>(freeList);
+        freeList = *static_cast<void**>(freeList);
+        header.pool = this;
+    } else {
+        // Cadre trop grand ou réserve épuisée : repli sur le tas
+        block = static_cast<unsigned char*>(::operator new(size + sizeof(Header)));
+        header.pool = nullptr;
+        heapFallbacks++;
+    }
+    *reinterpret_cast<Header*>(block) = header;
+    return block + sizeof(Header);
+}
+
+void FramePool::release(void* frame) {
+    unsigned char* block = static_cast<unsigned char*>(frame) - sizeof(Header);
+    FramePool* pool = reinterpret_cast<Header*>(block)->pool;
+    if (!pool) {
+        ::operator delete(block);
+        return;
+    }
+    *reinterpret_cast<void**>(block) = pool->freeList;
+    pool->freeList = block;
+}
+
+} // namespace Behavior
@@ -0,0 +1,147 @@
+#include "CrowdSteering.hpp"
+#include "Enemy.hpp"
+#include "SimMath.hpp"
+#include "VectorBatch.hpp"
+#include <cmath>
+
+namespace {
+
+// Distance à laquelle un ennemi perçoit ses voisins (et taille des cellules) :
+// la portée de la séparation entre deux ennemis de rayon 12
+const float NEIGHBOUR_RADIUS = 36.0f;
+// Séparation jusqu'à 1.5 fois la distance de contact
+const float SEPARATION_RANGE = 1.5f;
+// Évitement des voisins situés jusqu'à cette distance devant soi
+const float AVOIDANCE_LOOKAHEAD = 36.0f;
+
+const float SEPARATION_WEIGHT = 1.2f;
+const float ALIGNMENT_WEIGHT = 0.2f;
+const float AVOIDANCE_WEIGHT = 0.8f;
+
+// Norme maximale de la correction, relative à une direction unitaire
+const float MAX_STEERING = 1.5f;
+
+} // namespace
+
+CrowdSteering::CrowdSteering(int width, int height, int maxEnemies)
+    : grid(static_cast<float>(width), static_cast<float>(height), NEIGHBOUR_RADIUS, maxEnemies, 0.0f) {
+    positionX.reserve(maxEnemies);
+    positionY.reserve(maxEnemies);
+    velocityX.reserve(maxEnemies);
+    velocityY.reserve(maxEnemies);
+    headingX.reserve(maxEnemies);
+    headingY.reserve(maxEnemies);
+    radius.reserve(maxEnemies);
+    pointRadius.reserve(maxEnemies);
+    neighbours.reserve(maxEnemies);
+}
+
+CrowdSteering::~CrowdSteering() {}
+
+void CrowdSteering::apply(std::vector<Enemy>& enemies) {
+    int count = static_cast<int>(enemies.size());
+    positionX.resize(count);
+    positionY.resize(count);
+    velocityX.resize(count);
+    velocityY.resize(count);
+    headingX.resize(count);
+    headingY.resize(count);
+    radius.resize(count);
+    neighbours.resize(count);
+    pointRadius.assign(count, 0.0f);
+
+    // Rayon nul : ennemi mort, ignoré
+    for (int i = 0; i < count; i++) {
+        const Enemy& enemy = enemies[i];
+        Vector2D position = enemy.getPosition();
+        Vector2D velocity = enemy.getVelocity();
+        positionX[i] = position.x;
+        positionY[i] = position.y;
+        velocityX[i] = velocity.x;
+        velocityY[i] = velocity.y;
+        radius[i] = enemy.isDead() ? 0.0f : static_cast<float>(enemy.getRadius());
+    }
+
+    // Direction de marche de chacun (nulle à l'arrêt : pas d'évitement)
+    headingX = velocityX;
+    headingY = velocityY;
+    VectorBatch::normalize(headingX.data(), headingY.data(), count);
+
+    // Les ennemis sont rangés comme des points : la requête couvre déjà
+    // toute la distance de perception
+    grid.build(count, positionX.data(), positionY.data(), pointRadius.data());
+
+    // Les calculs ne lisent que la copie : transmettre une correction ne
+    // change pas celles des ennemis suivants
+    for (int i = 0; i < count; i++) {
+        if (radius[i] == 0.0f) continue;
+
+        float separationX = 0.0f;
+        float separationY = 0.0f;
+        float alignmentX = 0.0f;
+        float alignmentY = 0.0f;
+        float avoidanceX = 0.0f;
+        float avoidanceY = 0.0f;
+        int alignmentCount = 0;
+
+        int found = grid.queryUnsorted(positionX[i] - NEIGHBOUR_RADIUS, positionY[i] - NEIGHBOUR_RADIUS,
+                                       positionX[i] + NEIGHBOUR_RADIUS, positionY[i] + NEIGHBOUR_RADIUS,
+                                       neighbours.data(), count);
+        for (int k = 0; k < found; k++) {
+            int j = neighbours[k];
+            if (j == i || radius[j] == 0.0f) continue;
+
+            float dx = positionX[j] - positionX[i];
+            float dy = positionY[j] - positionY[i];
+            float distanceSq = dx * dx + dy * dy;
+            if (distanceSq >= NEIGHBOUR_RADIUS * NEIGHBOUR_RADIUS) continue;
+
+            float contactDistance = radius[i] + radius[j];
+
+            // Séparation : d'autant plus forte que le voisin est proche
+            float separationDistance = contactDistance * SEPARATION_RANGE;
+            if (distanceSq < separationDistance * separationDistance) {
+                float distance = simLength(dx, dy);
+                if (distance > 0.0f) {
+                    float weight = 1.0f - distance / separationDistance;
+                    separationX -= dx / distance * weight;
+                    separationY -= dy / distance * weight;
+                } else {
+                    // Positions confondues : départager par l'indice
+                    separationX += i < j ? -1.0f : 1.0f;
+                }
+            }
+
+            // Alignement : vitesse moyenne des voisins
+            alignmentX += velocityX[j];
+            alignmentY += velocityY[j];
+            alignmentCount++;
+
+            // Évitement : un voisin devant soi, sur la trajectoire, fait
+            // dévier sur le côté opposé
+            float ahead = dx * headingX[i] + dy * headingY[i];
+            float side = dy * headingX[i] - dx * headingY[i];
+            if (ahead > 0.0f && ahead < AVOIDANCE_LOOKAHEAD && std::abs(side) < contactDistance) {
+                float weight = 1.0f - ahead / AVOIDANCE_LOOKAHEAD;
+                float sign = side > 0.0f ? -1.0f : 1.0f;
+                avoidanceX += -headingY[i] * sign * weight;
+                avoidanceY += headingX[i] * sign * weight;
+            }
+        }
+
+        float steeringX = separationX * SEPARATION_WEIGHT + avoidanceX * AVOIDANCE_WEIGHT;
+        float steeringY = separationY * SEPARATION_WEIGHT + avoidanceY * AVOIDANCE_WEIGHT;
+        if (alignmentCount > 0) {
+            steeringX += (alignmentX / alignmentCount - velocityX[i]) * ALIGNMENT_WEIGHT;
+            steeringY += (alignmentY / alignmentCount - velocityY[i]) * ALIGNMENT_WEIGHT;
+        }
+
+        float steeringLength = simLength(steeringX, steeringY);
+        if (steeringLength > MAX_STEERING) {
+            steeringX = steeringX / steeringLength * MAX_STEERING;
+            steeringY = steeringY / steeringLength * MAX_STEERING;
+        }
+
+        enemies[i].setSteering(Vector2D(steeringX, steeringY));
+    }
+}
@@ -1,13 +1,18 @@
 #include "Enemy.hpp"
 #include "Room.hpp"
+#include "Snapshot.hpp"
+#include "SimMath.hpp"
+#include "Collision.hpp"
+#include "FrameProfiler.hpp"
+#include "AiScheduler.hpp"
 #include <cmath>
-#include <cstdlib>
-#include <ctime>
 
-Enemy::Enemy(float x, float y)
+Enemy::Enemy(float x, float y, uint64_t patrolSeed)
     : position(x, y),
       velocity(0, 0),
       patrolTarget(x, y),
+      steering(0, 0),
+      patrolRandom(patrolSeed),
       state(EnemyState::PATROL),
       speed(1.5f),
       radius(12),
@@ -16,20 +21,18 @@ Enemy::Enemy(float x, float y)
       lightRadius(80),
       detectionRadius(200.0f),
       attackRadius(5.0f),  // Réduit de 30 à 5 pour s'approcher très près
-      attackCooldown(0),
-      attackCooldownMax(60),
       animationPhase(0.0f),
       animationSpeed(0.1f),
       knockbackVelocity(0, 0),
       knockbackFrames(0),
-      knockbackDuration(15) {
-
-    // Initialiser le générateur aléatoire
-    static bool seeded = false;
-    if (!seeded) {
-        std::srand(static_cast<unsigned>(std::time(nullptr)));
-        seeded = true;
-    }
+      knockbackDuration(15),
+      nextThinkTick(0),
+      thinkDeferrable(false),
+      coastFrames(0),
+      chaseBlocked(false),
+      blockedStep(x, y),
+      interrupted(false),
+      thinkSlot(0) {
 
     generatePatrolTarget();
 }
@@ -42,8 +45,8 @@ void Enemy::generatePatrolTarget() {
     // Essayer jusqu'à 10 fois de trouver une position qui n'est pas dans une zone interdite
     for (int attempt = 0; attempt < 10; attempt++) {
         // Générer X entre 100 et 700 (éviter les zones de départ et d'arrivée)
-        float targetX = 100 + (std::rand() % 600);
-        float targetY = 80 + (std::rand() % (600 - 160));
+        float targetX = 100 + patrolRandom.nextInt(600);
+        float targetY = 80 + patrolRandom.nextInt(600 - 160);
 
         // Vérifier que la position n'est pas dans une zone interdite
         if (!isInForbiddenZone(targetX, targetY)) {
@@ -57,9 +60,7 @@ void Enemy::generatePatrolTarget() {
 }
 
 float Enemy::distance(const Vector2D& a, const Vector2D& b) {
-    float dx = b.x - a.x;
-    float dy = b.y - a.y;
-    return std::sqrt(dx * dx + dy * dy);
+    return simLength(b.x - a.x, b.y - a.y);
 }
 
 bool Enemy::isInForbiddenZone(float x, float /* y */) const {
@@ -82,6 +83,8 @@ bool Enemy::isHoleAt(float x, float y, Room* room) {
 bool Enemy::isPathSafe(const Vector2D& target, Room* room) {
     if (!room) return true;
 
+    PROFILE_COUNT(ProfilePhase::PATH_SAFETY);
+
     // Vérifier si la cible est dans une zone interdite
     if (isInForbiddenZone(target.x, target.y)) {
         return false;
@@ -89,7 +92,7 @@ bool Enemy::isPathSafe(const Vector2D& target, Room* room) {
 
     // Vérifier plusieurs points le long du chemin
     Vector2D direction = target - position;
-    float dist = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    float dist = simLength(direction.x, direction.y);
 
     if (dist < 1.0f) return true;
 
@@ -119,7 +122,9 @@ bool Enemy::isPathSafe(const Vector2D& target, Room* room) {
     return true;
 }
 
-void Enemy::updatePatrol(Room* room) {
+void Enemy::updatePatrol(Room* room, int span) {
+    coastFrames = 0;
+
     // Se déplacer vers la cible de patrouille
     float dist = distance(position, patrolTarget);
 
@@ -129,7 +134,7 @@ void Enemy::updatePatrol(Room* room) {
     } else {
         // Se déplacer vers la cible
         Vector2D direction = patrolTarget - position;
-        float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        float length = simLength(direction.x, direction.y);
         if (length > 0) {
             direction.x /= length;
             direction.y /= length;
@@ -137,10 +142,12 @@ void Enemy::updatePatrol(Room* room) {
 
         velocity = direction * speed * 0.5f; // Patrouille plus lente
 
-        // Vérifier si la prochaine position est sûre
-        Vector2D nextPos = position + velocity;
+        // Vérifier si la prochaine position est sûre (jusqu'à la prochaine
+        // réflexion quand l'ennemi est cadencé moins souvent)
+        Vector2D nextPos = position + velocity * static_cast<float>(span);
         if (isPathSafe(nextPos, room)) {
             position += velocity;
+            coastFrames = span - 1;
         } else {
             // Chemin bloqué, générer nouvelle cible
             generatePatrolTarget();
@@ -149,15 +156,29 @@ void Enemy::updatePatrol(Room* room) {
 }
 
 void Enemy::updateChase(const Vector2D& playerPos, Room* room) {
+    coastFrames = 0;
+    chaseBlocked = false;
+
     // Se déplacer vers le joueur
     Vector2D direction = playerPos - position;
-    float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    float length = simLength(direction.x, direction.y);
 
     if (length > 0) {
         direction.x /= length;
         direction.y /= length;
     }
 
+    // Ne pas s'empiler sur les autres poursuivants (séparation, alignement,
+    // évitement) ; sans voisin la trajectoire reste inchangée
+    if (steering.x != 0.0f || steering.y != 0.0f) {
+        direction += steering;
+        float steeredLength = simLength(direction.x, direction.y);
+        if (steeredLength > 0) {
+            direction.x /= steeredLength;
+            direction.y /= steeredLength;
+        }
+    }
+
     velocity = direction * speed;
 
     // Vérifier si la prochaine position est sûre
@@ -179,10 +200,8 @@ void Enemy::updateChase(const Vector2D& playerPos, Room* room) {
 
         if (leftSafe && rightSafe) {
             // Les deux côtés sont sûrs, choisir le plus proche du joueur
-            float distLeft = std::sqrt((sidePos1.x - playerPos.x) * (sidePos1.x - playerPos.x) +
-                                      (sidePos1.y - playerPos.y) * (sidePos1.y - playerPos.y));
-            float distRight = std::sqrt((sidePos2.x - playerPos.x) * (sidePos2.x - playerPos.x) +
-                                       (sidePos2.y - playerPos.y) * (sidePos2.y - playerPos.y));
+            float distLeft = distance(sidePos1, playerPos);
+            float distRight = distance(sidePos2, playerPos);
 
             position = (distLeft < distRight) ? sidePos1 : sidePos2;
         } else if (leftSafe) {
@@ -192,14 +211,14 @@ void Enemy::updateChase(const Vector2D& playerPos, Room* room) {
         } else {
             // 2. Les côtés sont bloqués, essayer les diagonales
             Vector2D diag1 = (direction + sideDir1);
-            float diagLen1 = std::sqrt(diag1.x * diag1.x + diag1.y * diag1.y);
+            float diagLen1 = simLength(diag1.x, diag1.y);
             if (diagLen1 > 0) {
                 diag1.x /= diagLen1;
                 diag1.y /= diagLen1;
             }
 
             Vector2D diag2 = (direction + sideDir2);
-            float diagLen2 = std::sqrt(diag2.x * diag2.x + diag2.y * diag2.y);
+            float diagLen2 = simLength(diag2.x, diag2.y);
             if (diagLen2 > 0) {
                 diag2.x /= diagLen2;
                 diag2.y /= diagLen2;
@@ -217,31 +236,35 @@ void Enemy::updateChase(const Vector2D& playerPos, Room* room) {
                 Vector2D backPos = position + (direction * -1.0f) * (speed * 0.5f);
                 if (isPathSafe(backPos, room)) {
                     position = backPos;
+                } else {
+                    // Sinon rester sur place jusqu'à ce que le pas direct se libère
+                    chaseBlocked = true;
+                    blockedStep = nextPos;
                 }
-                // Sinon rester sur place
             }
         }
     }
 }
 
-void Enemy::updateAttack() {
-    // Réduire le cooldown d'attaque
-    if (attackCooldown > 0) {
-        attackCooldown--;
-    }
-
-    // L'ennemi s'arrête pendant l'attaque
-    velocity.zero();
-}
-
-void Enemy::updateKnockback() {
+void Enemy::updateKnockback(Room* room) {
     if (knockbackFrames > 0) {
+        // Le recul s'arrête au bord d'un trou au lieu de le traverser
+        // (même rayon que isHoleAt)
+        Vector2D nextPos = position + knockbackVelocity;
+        float t;
+        if (room && room->sweepHoles(position, nextPos, 1, t)) {
+            position = Collision::pointAt(position, nextPos, t);
+            knockbackVelocity.zero();
+            knockbackFrames = 0;
+            return;
+        }
+
         // Appliquer le recul
-        position += knockbackVelocity;
+        position = nextPos;
 
         // Réduire progressivement la vélocité du recul
-        knockbackVelocity.x *= 0.85f;
-        knockbackVelocity.y *= 0.85f;
+        knockbackVelocity.x = simFloat(SimReal(knockbackVelocity.x) * SimReal(0.85f));
+        knockbackVelocity.y = simFloat(SimReal(knockbackVelocity.y) * SimReal(0.85f));
 
         knockbackFrames--;
 
@@ -251,59 +274,128 @@ void Enemy::updateKnockback() {
     }
 }
 
-void Enemy::update(const Vector2D& playerPos, Room* room) {
-    if (state == EnemyState::DEAD) {
-        return;
-    }
+Behavior::Task Enemy::behave(Behavior::FramePool& /* pool */, Behavior::Context& context) {
+    using namespace Behavior;
 
-    // Gérer le recul en priorité
-    if (knockbackFrames > 0) {
-        updateKnockback();
-        return;
-    }
-
-    float distToPlayer = distance(position, playerPos);
+    // Chaque tour de boucle commence par une attente dont la condition ne
+    // dépend que des champs de l'ennemi : c'est ce qui rend le script
+    // relançable à l'identique
+    for (;;) {
+        if (state == EnemyState::DEAD) {
+            co_return;
+        }
 
-    // Machine à états
-    switch (state) {
-        case EnemyState::PATROL:
-            updatePatrol(room);
+        // Recul : une frame après l'autre, en priorité sur le reste
+        if (knockbackFrames > 0) {
+            co_await untilTick(nextThinkTick);
+            updateKnockback(context.room);
+            nextThinkTick = context.tick + 1;
+            continue;
+        }
 
-            // Détection du joueur
-            if (distToPlayer < detectionRadius) {
-                state = EnemyState::CHASE;
+        switch (state) {
+            case EnemyState::IDLE:
+                // Immobile jusqu'à ce que le joueur s'approche
+                co_await untilPlayerWithin(detectionRadius);
+                state = EnemyState::PATROL;
+                nextThinkTick = context.tick + 1;
+                break;
+
+            case EnemyState::PATROL: {
+                // Loin du joueur, réfléchir à 10 Hz (étalé selon le rang) ;
+                // se réveiller aussitôt qu'il approche de la zone de détection
+                const float wakeRadius = detectionRadius + AiRates::WAKE_MARGIN;
+                Wait nextThink = untilTick(nextThinkTick);
+                if (thinkDeferrable) nextThink = deferrable(nextThink);
+                co_await (nextThink | untilPlayerWithin(wakeRadius));
+
+                // Une réflexion reportée garde l'intervalle plein (la charge
+                // reste étalée), sinon la suivante tombe sur la frame du rang
+                float distToPlayer = distance(position, context.playerPos);
+                int span = 1;
+                if (distToPlayer >= wakeRadius) {
+                    bool late = thinkDeferrable && context.tick > nextThinkTick;
+                    span = late ? AiRates::PATROL_INTERVAL
+                                : AiRates::PATROL_INTERVAL - (context.tick + thinkSlot) % AiRates::PATROL_INTERVAL;
+                }
+                updatePatrol(context.room, span);
+                nextThinkTick = context.tick + span;
+                thinkDeferrable = span > 1;
+
+                // Détection du joueur
+                if (distToPlayer < detectionRadius) {
+                    state = EnemyState::CHASE;
+                    thinkDeferrable = false;
+                }
+                break;
             }
-            break;
 
-        case EnemyState::CHASE:
-            updateChase(playerPos, room);
+            case EnemyState::CHASE: {
+                // Pas direct bloqué : attendre qu'il se libère (ou replanifier
+                // un peu plus tard si le joueur a bougé)
+                if (chaseBlocked) {
+                    co_await (untilPathClear(blockedStep) | untilTick(nextThinkTick));
+                } else {
+                    co_await untilTick(nextThinkTick);
+                }
 
-            // Le joueur est à portée d'attaque
-            if (distToPlayer < attackRadius) {
-                state = EnemyState::ATTACK;
-                attackCooldown = attackCooldownMax;
-            }
+                float distToPlayer = distance(position, context.playerPos);
+                updateChase(context.playerPos, context.room);
+                nextThinkTick = context.tick + (chaseBlocked ? AiRates::BLOCKED_RETRY_TICKS : 1);
 
-            // Le joueur s'est échappé
-            if (distToPlayer > detectionRadius * 1.5f) {
-                state = EnemyState::PATROL;
-                generatePatrolTarget();
-            }
-            break;
+                // Le joueur est à portée d'attaque : s'arrêter
+                if (distToPlayer < attackRadius) {
+                    state = EnemyState::ATTACK;
+                    velocity.zero();
+                }
 
-        case EnemyState::ATTACK:
-            updateAttack();
+                // Le joueur s'est échappé
+                if (distToPlayer > detectionRadius * 1.5f) {
+                    state = EnemyState::PATROL;
+                    generatePatrolTarget();
+                }
+                break;
+            }
 
-            // Retourner en poursuite si le joueur s'éloigne
-            if (distToPlayer > attackRadius * 1.5f) {
+            case EnemyState::ATTACK:
+                // Sur place tant que le joueur reste au contact
+                co_await untilPlayerBeyond(attackRadius * 1.5f);
                 state = EnemyState::CHASE;
-            }
-            break;
+                nextThinkTick = context.tick + 1;
+                break;
+
+            default:
+                break;
+        }
 
-        default:
-            break;
+        clampToArena();
+        advanceAnimation();
     }
+}
+
+void Enemy::drift() {
+    if (state == EnemyState::DEAD) {
+        return;
+    }
+
+    // Prolonger le déplacement vérifié par la dernière réflexion ; au-delà,
+    // attendre sur place la réflexion suivante
+    if (coastFrames > 0) {
+        position += velocity;
+        coastFrames--;
+    }
+
+    clampToArena();
+    advanceAnimation();
+}
 
+bool Enemy::consumeInterrupt() {
+    bool wasInterrupted = interrupted;
+    interrupted = false;
+    return wasInterrupted;
+}
+
+void Enemy::clampToArena() {
     // Limites de l'écran et zones interdites
     if (position.x < 40 + radius) position.x = 40 + radius;
     if (position.x > 800 - 40 - radius) position.x = 800 - 40 - radius;
@@ -313,8 +405,9 @@ void Enemy::update(const Vector2D& playerPos, Room* room) {
     // Empêcher l'ennemi d'entrer dans les zones de départ et d'arrivée
     if (position.x < 100) position.x = 100;
     if (position.x > 700) position.x = 700;
+}
 
-    // Animation
+void Enemy::advanceAnimation() {
     animationPhase += animationSpeed;
     if (animationPhase > 2 * M_PI) {
         animationPhase -= 2 * M_PI;
@@ -326,6 +419,11 @@ void Enemy::takeDamage(int damage, const Vector2D& attackerPos) {
         return;
     }
 
+    // Le script dort peut-être sur une autre condition : le relancer
+    interrupted = true;
+    nextThinkTick = 0;
+    coastFrames = 0;
+
     health -= damage;
     if (health <= 0) {
         health = 0;
@@ -333,103 +431,62 @@ void Enemy::takeDamage(int damage, const Vector2D& attackerPos) {
     } else {
         // Calculer la direction du recul (opposée à l'attaquant)
         Vector2D knockbackDir = position - attackerPos;
-        float length = std::sqrt(knockbackDir.x * knockbackDir.x + knockbackDir.y * knockbackDir.y);
+        SimReal dirX = knockbackDir.x;
+        SimReal dirY = knockbackDir.y;
+        SimReal length = simHypot(dirX, dirY);
 
-        if (length > 0) {
-            knockbackDir.x /= length;
-            knockbackDir.y /= length;
+        if (length > SimReal(0)) {
+            dirX = dirX / length;
+            dirY = dirY / length;
         }
 
         // Recul de 2 fois la taille de l'ennemi
-        float knockbackDistance = radius * 2.0f;
-        knockbackVelocity = knockbackDir * (knockbackDistance / knockbackDuration);
+        SimReal knockbackSpeed = SimReal(radius * 2) / SimReal(knockbackDuration);
+        knockbackVelocity = Vector2D(simFloat(dirX * knockbackSpeed), simFloat(dirY * knockbackSpeed));
         knockbackFrames = knockbackDuration;
     }
 }
 
-void Enemy::drawFilledCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) {
-    for (int y = -radius; y <= radius; y++) {
-        for (int x = -radius; x <= radius; x++) {
-            if (x * x + y * y <= radius * radius) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
+void Enemy::saveState(EnemySnapshot& snapshot) const {
+    snapshot.position = position;
+    snapshot.velocity = velocity;
+    snapshot.patrolTarget = patrolTarget;
+    snapshot.knockbackVelocity = knockbackVelocity;
+    patrolRandom.getState(snapshot.patrolRandom.state);
+    snapshot.state = static_cast<int32_t>(state);
+    snapshot.health = health;
+    snapshot.knockbackFrames = knockbackFrames;
+    snapshot.animationPhase = animationPhase;
+    snapshot.nextThinkTick = nextThinkTick;
+    snapshot.coastFrames = coastFrames;
+    snapshot.blockedStep = blockedStep;
+    snapshot.thinkDeferrable = thinkDeferrable ? 1 : 0;
+    snapshot.chaseBlocked = chaseBlocked ? 1 : 0;
 }
 
-void Enemy::drawGradientCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius,
-                                int r, int g, int b, int maxAlpha) {
-    for (int y = -radius; y <= radius; y++) {
-        for (int x = -radius; x <= radius; x++) {
-            int distSquared = x * x + y * y;
-            int radiusSquared = radius * radius;
-
-            if (distSquared <= radiusSquared) {
-                float dist = std::sqrt(static_cast<float>(distSquared)) / radius;
-                float alpha = maxAlpha * (1.0f - dist * dist);
-
-                SDL_SetRenderDrawColor(renderer, r, g, b, static_cast<Uint8>(alpha));
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
+bool Enemy::isValid(const EnemySnapshot& snapshot, int32_t aiTick) {
+    if (snapshot.state < static_cast<int32_t>(EnemyState::IDLE) ||
+        snapshot.state > static_cast<int32_t>(EnemyState::DEAD)) {
+        return false;
     }
+    // 0 à l'apparition, sinon programmée depuis une frame déjà jouée
+    return snapshot.nextThinkTick >= 0 &&
+           snapshot.nextThinkTick <= aiTick + AiRates::MAX_THINK_DELAY;
 }
 
-void Enemy::render(SDL_Renderer* renderer) {
-    if (state == EnemyState::DEAD) {
-        return;
-    }
-
-    int centerX = static_cast<int>(position.x);
-    int centerY = static_cast<int>(position.y);
-
-    // Ombre
-    int shadowY = centerY + 15;
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 40);
-    drawFilledCircle(renderer, centerX, shadowY, radius);
-
-    // Pulsation basée sur l'état
-    float pulse = 1.0f;
-    if (state == EnemyState::CHASE) {
-        pulse = 1.0f + 0.2f * std::sin(animationPhase * 3);
-    } else if (state == EnemyState::ATTACK) {
-        pulse = 1.0f + 0.3f * std::sin(animationPhase * 5);
-    } else {
-        pulse = 1.0f + 0.1f * std::sin(animationPhase);
-    }
-
-    int currentRadius = static_cast<int>(radius * pulse);
-
-    // Halo (rouge pour ennemi)
-    int haloRadius = static_cast<int>(currentRadius * 1.8f);
-    drawGradientCircle(renderer, centerX, centerY, haloRadius, 255, 0, 0, 60);
-
-    // Corps de l'ennemi - rouge sombre
-    SDL_SetRenderDrawColor(renderer, 150, 30, 30, 255);
-    drawFilledCircle(renderer, centerX, centerY, currentRadius);
-
-    // Centre lumineux rouge
-    SDL_SetRenderDrawColor(renderer, 255, 60, 60, 255);
-    drawFilledCircle(renderer, centerX, centerY, currentRadius / 2);
-
-    // Brillance
-    SDL_SetRenderDrawColor(renderer, 255, 100, 100, 255);
-    drawFilledCircle(renderer, centerX - 2, centerY - 2, currentRadius / 3);
-
-    // Barre de vie
-    int barWidth = 30;
-    int barHeight = 4;
-    int barX = centerX - barWidth / 2;
-    int barY = centerY - radius - 10;
-
-    // Fond de la barre
-    SDL_SetRenderDrawColor(renderer, 50, 50, 50, 255);
-    SDL_Rect bgRect = {barX, barY, barWidth, barHeight};
-    SDL_RenderFillRect(renderer, &bgRect);
-
-    // Vie actuelle
-    int healthWidth = (health * barWidth) / maxHealth;
-    SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
-    SDL_Rect healthRect = {barX, barY, healthWidth, barHeight};
-    SDL_RenderFillRect(renderer, &healthRect);
+void Enemy::loadState(const EnemySnapshot& snapshot) {
+    position = snapshot.position;
+    velocity = snapshot.velocity;
+    patrolTarget = snapshot.patrolTarget;
+    knockbackVelocity = snapshot.knockbackVelocity;
+    patrolRandom.setState(snapshot.patrolRandom.state);
+    state = static_cast<EnemyState>(snapshot.state);
+    health = snapshot.health;
+    knockbackFrames = snapshot.knockbackFrames;
+    animationPhase = snapshot.animationPhase;
+    nextThinkTick = snapshot.nextThinkTick;
+    coastFrames = snapshot.coastFrames;
+    blockedStep = snapshot.blockedStep;
+    thinkDeferrable = snapshot.thinkDeferrable != 0;
+    chaseBlocked = snapshot.chaseBlocked != 0;
 }
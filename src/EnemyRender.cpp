@@ -0,0 +1,91 @@
+#include "Enemy.hpp"
+#include "FastMath.hpp"
+#include <SDL2/SDL.h>
+#include <cmath>
+
+void Enemy::drawFilledCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) {
+    for (int y = -radius; y <= radius; y++) {
+        for (int x = -radius; x <= radius; x++) {
+            if (x * x + y * y <= radius * radius) {
+                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
+            }
+        }
+    }
+}
+
+void Enemy::drawGradientCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius,
+                                int r, int g, int b, int maxAlpha) {
+    for (int y = -radius; y <= radius; y++) {
+        for (int x = -radius; x <= radius; x++) {
+            int distSquared = x * x + y * y;
+            int radiusSquared = radius * radius;
+
+            if (distSquared <= radiusSquared) {
+                // (distance / rayon)² sans racine
+                float alpha = maxAlpha * (1.0f - static_cast<float>(distSquared) / radiusSquared);
+
+                SDL_SetRenderDrawColor(renderer, r, g, b, static_cast<Uint8>(alpha));
+                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
+            }
+        }
+    }
+}
+
+void Enemy::render(SDL_Renderer* renderer) {
+    if (state == EnemyState::DEAD) {
+        return;
+    }
+
+    int centerX = static_cast<int>(position.x);
+    int centerY = static_cast<int>(position.y);
+
+    // Ombre
+    int shadowY = centerY + 15;
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 40);
+    drawFilledCircle(renderer, centerX, shadowY, radius);
+
+    // Pulsation basée sur l'état
+    float pulse = 1.0f;
+    if (state == EnemyState::CHASE) {
+        pulse = 1.0f + 0.2f * FastMath::sin(animationPhase * 3);
+    } else if (state == EnemyState::ATTACK) {
+        pulse = 1.0f + 0.3f * FastMath::sin(animationPhase * 5);
+    } else {
+        pulse = 1.0f + 0.1f * FastMath::sin(animationPhase);
+    }
+
+    int currentRadius = static_cast<int>(radius * pulse);
+
+    // Halo (rouge pour ennemi)
+    int haloRadius = static_cast<int>(currentRadius * 1.8f);
+    drawGradientCircle(renderer, centerX, centerY, haloRadius, 255, 0, 0, 60);
+
+    // Corps de l'ennemi - rouge sombre
+    SDL_SetRenderDrawColor(renderer, 150, 30, 30, 255);
+    drawFilledCircle(renderer, centerX, centerY, currentRadius);
+
+    // Centre lumineux rouge
+    SDL_SetRenderDrawColor(renderer, 255, 60, 60, 255);
+    drawFilledCircle(renderer, centerX, centerY, currentRadius / 2);
+
+    // Brillance
+    SDL_SetRenderDrawColor(renderer, 255, 100, 100, 255);
+    drawFilledCircle(renderer, centerX - 2, centerY - 2, currentRadius / 3);
+
+    // Barre de vie
+    int barWidth = 30;
+    int barHeight = 4;
+    int barX = centerX - barWidth / 2;
+    int barY = centerY - radius - 10;
+
+    // Fond de la barre
+    SDL_SetRenderDrawColor(renderer, 50, 50, 50, 255);
+    SDL_Rect bgRect = {barX, barY, barWidth, barHeight};
+    SDL_RenderFillRect(renderer, &bgRect);
+
+    // Vie actuelle
+    int healthWidth = (health * barWidth) / maxHealth;
+    SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
+    SDL_Rect healthRect = {barX, barY, healthWidth, barHeight};
+    SDL_RenderFillRect(renderer, &healthRect);
+}
@@ -0,0 +1,141 @@
+#include "FramePacer.hpp"
+#include <SDL2/SDL.h>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+
+namespace {
+
+// Fin d'attente en boucle active : SDL_Delay peut dormir une milliseconde
+// de plus que demandé, voire davantage selon l'ordonnanceur
+const double SPIN_MARGIN_MS = 2.0;
+// Intervalle compté comme un retard au-delà d'une période et demie
+const double LATE_FACTOR = 1.5;
+// Écart toléré entre la fréquence de l'écran et la cadence cible
+const int REFRESH_TOLERANCE_HZ = 1;
+// Vsync : une frame présentée plus courte que 90 % de la période n'a pas
+// attendu l'écran ; elle est complétée, et après 30 d'affilée la
+// présentation n'est plus considérée comme bloquante
+const uint64_t PRESENT_FLOOR_PERCENT = 90;
+const int VSYNC_FALLBACK_FRAMES = 30;
+
+} // namespace
+
+FramePacer::FramePacer()
+    : frequency(SDL_GetPerformanceFrequency()),
+      period(0),
+      deadline(0),
+      lastFrame(0),
+      started(false),
+      presentPaced(false),
+      shortPresents(0),
+      frameCount(0),
+      meanMs(0.0),
+      squaredDeviations(0.0),
+      minMs(0.0),
+      maxMs(0.0),
+      lateFrames(0) {}
+
+void FramePacer::setTargetRate(int framesPerSecond) {
+    period = frequency / static_cast<uint64_t>(framesPerSecond);
+    started = false;
+}
+
+void FramePacer::setVsyncRefreshRate(int refreshRate) {
+    uint64_t targetRate = period > 0 ? (frequency + period / 2) / period : 0;
+    presentPaced = refreshRate > 0 &&
+                   std::abs(refreshRate - static_cast<int>(targetRate)) <= REFRESH_TOLERANCE_HZ;
+    shortPresents = 0;
+}
+
+void FramePacer::restart() {
+    started = false;
+}
+
+double FramePacer::countsToMs(uint64_t counts) const {
+    return static_cast<double>(counts) * 1000.0 / static_cast<double>(frequency);
+}
+
+uint64_t FramePacer::waitUntil(uint64_t target) const {
+    uint64_t now = SDL_GetPerformanceCounter();
+    if (now >= target) {
+        return now;
+    }
+
+    // Dormir jusqu'à la marge, puis finir sur le compteur
+    double remainingMs = countsToMs(target - now);
+    if (remainingMs > SPIN_MARGIN_MS) {
+        SDL_Delay(static_cast<Uint32>(remainingMs - SPIN_MARGIN_MS));
+    }
+    do {
+        now = SDL_GetPerformanceCounter();
+    } while (now < target);
+    return now;
+}
+
+void FramePacer::waitForNextFrame(bool presented) {
+    uint64_t now = SDL_GetPerformanceCounter();
+
+    if (!started) {
+        started = true;
+        lastFrame = now;
+        deadline = now + period;
+        return;
+    }
+
+    if (presentPaced && presented) {
+        // La présentation a normalement attendu l'écran ; sinon, compléter
+        // la frame jusqu'au plancher
+        uint64_t floor = lastFrame + period * PRESENT_FLOOR_PERCENT / 100;
+        if (now < floor) {
+            now = waitUntil(floor);
+            if (++shortPresents >= VSYNC_FALLBACK_FRAMES) {
+                presentPaced = false;
+                std::cout << "Synchronisation verticale non bloquante, cadence mesurée" << std::endl;
+            }
+        } else {
+            shortPresents = 0;
+        }
+    } else {
+        // Sans vsync, ou frame non présentée (fenêtre sans focus) : rien
+        // d'autre ne retient la boucle
+        now = waitUntil(deadline);
+    }
+
+    double intervalMs = countsToMs(now - lastFrame);
+    lastFrame = now;
+
+    frameCount++;
+    double delta = intervalMs - meanMs;
+    meanMs += delta / static_cast<double>(frameCount);
+    squaredDeviations += delta * (intervalMs - meanMs);
+    if (frameCount == 1 || intervalMs < minMs) minMs = intervalMs;
+    if (frameCount == 1 || intervalMs > maxMs) maxMs = intervalMs;
+    if (intervalMs > LATE_FACTOR * countsToMs(period)) lateFrames++;
+
+    // Échéance suivante ; après un retard de plus d'une période, repartir
+    // de maintenant plutôt que d'enchaîner des frames sans attente. Avec la
+    // vsync, l'écran donne le rythme : la frame suivante non présentée
+    // attend une période après celle-ci.
+    deadline += period;
+    if (presentPaced || now >= deadline) {
+        deadline = now + period;
+    }
+}
+
+void FramePacer::printReport() const {
+    if (frameCount == 0) return;
+
+    double deviationMs = frameCount > 1
+        ? std::sqrt(squaredDeviations / static_cast<double>(frameCount - 1))
+        : 0.0;
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Cadence: " << frameCount << " frames, "
+              << meanMs << " ms en moyenne (" << 1000.0 / meanMs << " images/s), "
+              << "écart-type " << deviationMs << " ms, "
+              << "min " << minMs << " ms, max " << maxMs << " ms, "
+              << lateFrames << " en retard" << std::endl;
+    std::cout << std::defaultfloat;
+}
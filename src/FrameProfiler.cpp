@@ -0,0 +1,215 @@
+#include "FrameProfiler.hpp"
+#include <iostream>
+#include <iomanip>
+
+namespace {
+
+const int PHASE_COUNT = static_cast<int>(ProfilePhase::COUNT);
+const int COUNTER_COUNT = static_cast<int>(PerfCounter::COUNT);
+
+const char* phaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::EVENTS:       return "events";
+        case ProfilePhase::UPDATE:       return "update";
+        case ProfilePhase::ENEMY_AI:     return "  enemy_ai";
+        case ProfilePhase::PATH_SAFETY:  return "    path_safety";
+        case ProfilePhase::RENDER:       return "render";
+        case ProfilePhase::PLAYER_LIGHT: return "  player_light";
+        default:                         return "?";
+    }
+}
+
+double counterValue(const double* totals, PerfCounter counter) {
+    return totals[static_cast<int>(counter)];
+}
+
+// Compteurs matériels (ou logiciels en repli) cumulés, ramenés à la frame
+void printCounters(std::ostream& out, const PerfCounters& counters, const double* totals, double frames) {
+    if (counters.hasHardwareCounters()) {
+        double cycles = counterValue(totals, PerfCounter::CYCLES);
+        double instructions = counterValue(totals, PerfCounter::INSTRUCTIONS);
+        if (cycles > 0.0) {
+            out << std::setprecision(2) << "  IPC " << instructions / cycles;
+        }
+        out << std::setprecision(0);
+        if (counters.isAvailable(PerfCounter::CACHE_MISSES)) {
+            out << "  cache-miss " << counterValue(totals, PerfCounter::CACHE_MISSES) / frames << "/f";
+        }
+        if (counters.isAvailable(PerfCounter::BRANCH_MISSES)) {
+            out << "  branch-miss " << counterValue(totals, PerfCounter::BRANCH_MISSES) / frames << "/f";
+        }
+    } else {
+        out << std::setprecision(3)
+            << "  cpu " << counterValue(totals, PerfCounter::TASK_CLOCK) / frames / 1.0e6 << " ms/f"
+            << std::setprecision(1)
+            << "  page-faults " << counterValue(totals, PerfCounter::PAGE_FAULTS) / frames << "/f";
+    }
+    out << std::setprecision(3);
+}
+
+} // namespace
+
+FrameProfiler::FrameProfiler()
+    : countersOpen(false),
+      initialized(false),
+      frameCount(0),
+      reportInterval(120) {
+    resetStats();
+}
+
+FrameProfiler::~FrameProfiler() {}
+
+FrameProfiler& FrameProfiler::getInstance() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+bool FrameProfiler::init(int reportIntervalFrames) {
+    reportInterval = reportIntervalFrames > 0 ? reportIntervalFrames : 120;
+    countersOpen = counters.open();
+    initialized = true;
+
+    if (!countersOpen) {
+        std::cerr << "Profilage : compteurs perf_event indisponibles, temps seuls" << std::endl;
+    } else if (!counters.hasHardwareCounters()) {
+        std::cerr << "Profilage : PMU inaccessible, repli sur les compteurs logiciels" << std::endl;
+    }
+
+    resetStats();
+    return countersOpen;
+}
+
+void FrameProfiler::resetPhase(PhaseStats& stats) {
+    stats.totalMs = 0.0;
+    stats.allocCount = 0;
+    stats.allocBytes = 0;
+    stats.calls = 0;
+    stats.countedCalls = 0;
+    for (int c = 0; c < COUNTER_COUNT; c++) {
+        stats.counterTotals[c] = 0.0;
+    }
+}
+
+void FrameProfiler::resetStats() {
+    for (int i = 0; i < PHASE_COUNT; i++) {
+        resetPhase(phases[i]);
+    }
+    resetPhase(frame);
+    frameCount = 0;
+}
+
+void FrameProfiler::beginMeasure(PhaseStats& stats) {
+    stats.startAllocs = AllocationTracker::threadStats();
+    // Lire les compteurs avant l'horloge : le coût de l'appel système
+    // reste hors de la mesure de temps
+    if (countersOpen) {
+        counters.read(stats.startSample);
+    }
+    stats.start = std::chrono::steady_clock::now();
+}
+
+void FrameProfiler::endMeasure(PhaseStats& stats) {
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - stats.start;
+    stats.totalMs += elapsed.count();
+    stats.calls++;
+
+    if (countersOpen) {
+        PerfSample end;
+        counters.read(end);
+        for (int c = 0; c < COUNTER_COUNT; c++) {
+            stats.counterTotals[c] += static_cast<double>(end.values[c] - stats.startSample.values[c]);
+        }
+    }
+
+    AllocationStats allocs = AllocationTracker::threadStats();
+    stats.allocCount += allocs.count - stats.startAllocs.count;
+    stats.allocBytes += allocs.bytes - stats.startAllocs.bytes;
+}
+
+void FrameProfiler::beginFrame() {
+    if (!initialized) return;
+    beginMeasure(frame);
+}
+
+void FrameProfiler::endFrame() {
+    if (!initialized) return;
+    endMeasure(frame);
+
+    frameCount++;
+    if (frameCount >= reportInterval) {
+        report();
+        resetStats();
+    }
+}
+
+void FrameProfiler::beginPhase(ProfilePhase phase) {
+    if (!initialized) return;
+    beginMeasure(phases[static_cast<int>(phase)]);
+}
+
+void FrameProfiler::endPhase(ProfilePhase phase) {
+    if (!initialized) return;
+    endMeasure(phases[static_cast<int>(phase)]);
+}
+
+void FrameProfiler::countCall(ProfilePhase phase) {
+    if (!initialized) return;
+    phases[static_cast<int>(phase)].countedCalls++;
+}
+
+void FrameProfiler::report() {
+    if (frameCount == 0) return;
+
+    double frames = static_cast<double>(frameCount);
+    std::ostream& out = std::cout;
+    std::ios::fmtflags oldFlags = out.flags();
+    std::streamsize oldPrecision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "=== Profil (" << frameCount << " frames, "
+        << frame.totalMs / frames << " ms/frame";
+    if (AllocationTracker::isEnabled()) {
+        out << std::setprecision(1) << ", " << frame.allocCount / frames << " allocs/frame, "
+            << frame.allocBytes / frames << " octets/frame" << std::setprecision(3);
+    }
+    out << ") ===" << std::endl;
+
+    // Frame entière, attente du framerate exclue
+    if (countersOpen) {
+        out << std::left << std::setw(18) << "frame" << std::right << std::setw(8)
+            << frame.totalMs / frames << " ms/frame";
+        printCounters(out, counters, frame.counterTotals, frames);
+        out << std::endl;
+    }
+
+    for (int i = 0; i < PHASE_COUNT; i++) {
+        const PhaseStats& stats = phases[i];
+        if (stats.calls == 0 && stats.countedCalls > 0) {
+            // Phase comptée seulement
+            out << std::left << std::setw(18) << phaseName(static_cast<ProfilePhase>(i))
+                << std::right << std::setprecision(1) << std::setw(8)
+                << stats.countedCalls / frames << " appels/frame" << std::setprecision(3) << std::endl;
+            continue;
+        }
+        if (stats.calls == 0) continue;
+
+        out << std::left << std::setw(18) << phaseName(static_cast<ProfilePhase>(i))
+            << std::right << std::setw(8) << stats.totalMs / frames << " ms/frame";
+
+        if (stats.calls > frameCount) {
+            out << "  (" << stats.calls / frameCount << " appels/frame)";
+        }
+
+        if (countersOpen) {
+            printCounters(out, counters, stats.counterTotals, frames);
+        }
+        if (stats.allocCount > 0) {
+            out << std::setprecision(1) << "  allocs " << stats.allocCount / frames << "/f ("
+                << stats.allocBytes / frames << " o/f)";
+        }
+        out << std::setprecision(3) << std::endl;
+    }
+
+    out.flags(oldFlags);
+    out.precision(oldPrecision);
+}
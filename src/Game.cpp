@@ -4,19 +4,57 @@
 #include "Enemy.hpp"
 #include "Menu.hpp"
 #include "Room.hpp"
+#include "Simulation.hpp"
 #include "AudioManager.hpp"
+#include "StarSpriteSheet.hpp"
 #include "ScoreManager.hpp"
+#include "FrameProfiler.hpp"
+#include "AllocationTracker.hpp"
+#include "Snapshot.hpp"
 #include <iostream>
-#include <cstdlib>
+#include <fstream>
 #include <cmath>
-#include <algorithm>
 
-Game::Game() : window(nullptr), renderer(nullptr), isRunning(false), lightTexture(nullptr), lightRadius(150), gameStarted(false), inRoom(false), currentLevel(1), windowWidth(800), windowHeight(600), totalScore(0), totalTime(0.0f), playerLives(3), playerHealth(12), invincibilityFrames(0), gameOver(false) {}
+namespace {
+
+// Attente maximale sans événement avant de revérifier l'état d'inactivité
+const int IDLE_WAIT_TIMEOUT_MS = 250;
+// Fenêtre sans focus : une image dessinée sur 6 (10 images/s à 60 Hz), la
+// simulation gardant sa cadence
+const int UNFOCUSED_RENDER_STRIDE = 6;
+
+// Sauvegarde rapide (F5), rechargée au démarrage pour F9
+const char* QUICK_SAVE_FILE = "amazing_ball_quicksave.dat";
+
+// Instantané des touches de déplacement depuis SDL
+uint8_t readHeldKeys() {
+    const Uint8* keyState = SDL_GetKeyboardState(nullptr);
+    uint8_t keys = 0;
+    if (keyState[SDL_SCANCODE_UP]) keys |= InputKeys::UP;
+    if (keyState[SDL_SCANCODE_DOWN]) keys |= InputKeys::DOWN;
+    if (keyState[SDL_SCANCODE_LEFT]) keys |= InputKeys::LEFT;
+    if (keyState[SDL_SCANCODE_RIGHT]) keys |= InputKeys::RIGHT;
+    if (keyState[SDL_SCANCODE_BACKSPACE]) keys |= InputKeys::REWIND;
+    return keys;
+}
+
+} // namespace
+
+Game::Game() : window(nullptr), renderer(nullptr), isRunning(false),
+               windowHidden(false), windowFocused(true), unfocusedFrames(0), runSeed(0), fixedSeed(false), lightTexture(nullptr), lightRadius(150), windowWidth(800), windowHeight(600),
+               tickRate(SIMULATION_RATE), substeps(1), vsync(false), framePresented(false) {
+    pacer.setTargetRate(SIMULATION_RATE);
+}
 
 Game::~Game() {
     clean();
 }
 
+void Game::setSeed(uint64_t seed) {
+    runSeed = seed;
+    fixedSeed = true;
+}
+
 bool Game::init(const char* title, int width, int height) {
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         std::cerr << "Erreur SDL_Init: " << SDL_GetError() << std::endl;
@@ -34,23 +72,38 @@ bool Game::init(const char* title, int width, int height) {
         return false;
     }
 
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+    if (vsync) {
+        rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    renderer = SDL_CreateRenderer(window, -1, rendererFlags);
 
     if (!renderer) {
         std::cerr << "Erreur SDL_CreateRenderer: " << SDL_GetError() << std::endl;
         return false;
     }
 
+    if (vsync) {
+        applyVsyncRefreshRate();
+    }
+
     isRunning = true;
 
+#ifdef AMAZING_BALL_PROFILE
+    // Compteurs matériels par phase (make PROFILE=1)
+    FrameProfiler::getInstance().init();
+#endif
+
     windowWidth = width;
     windowHeight = height;
 
-    // Créer le menu
-    menu = std::make_unique<Menu>();
-
-    // Initialiser le joueur au centre de l'écran
-    player = std::make_unique<Player>(width / 2, height / 2);
+    // Créer l'état du jeu (menu, joueur, salles, ennemis)
+    simulation = std::make_unique<Simulation>(width, height);
+    // Seul le menu affiché suit les meilleurs scores
+    simulation->getMenu().watchHighScores();
+    if (fixedSeed) {
+        simulation->setSeed(runSeed);
+    }
 
     // Créer une carte simple
     map = std::make_unique<Map>();
@@ -76,15 +129,23 @@ bool Game::init(const char* title, int width, int height) {
 
     map->loadMap(level1, 20, 15);
 
-    // Créer quelques ennemis
-    enemies.push_back(std::make_unique<Enemy>(200, 150));
-    enemies.push_back(std::make_unique<Enemy>(600, 200));
-    enemies.push_back(std::make_unique<Enemy>(400, 400));
-    enemies.push_back(std::make_unique<Enemy>(150, 450));
+    // Sauvegarde rapide d'une session précédente. Pas pendant un
+    // enregistrement ou un replay : la session doit partir d'un emplacement
+    // vide pour être rejouée à l'identique.
+    if (!recorder.isActive() && !replay.isActive() && std::ifstream(QUICK_SAVE_FILE).good()) {
+        std::unique_ptr<WorldSnapshot> saved = std::make_unique<WorldSnapshot>();
+        if (readSnapshotFile(QUICK_SAVE_FILE, *saved) && simulation->restoreQuickSave(*saved)) {
+            std::cout << "Sauvegarde rapide chargée (F9 pour la reprendre)" << std::endl;
+        }
+    }
 
     // Créer la texture de lumière
     createLightTexture();
 
+    // Thread de préparation des salles
+    roomBuilder.start();
+    simulation->setRoomBuilder(&roomBuilder);
+
     // Initialiser l'AudioManager
     if (!AudioManager::getInstance().init()) {
         std::cerr << "Erreur d'initialisation de l'AudioManager" << std::endl;
@@ -108,365 +169,256 @@ bool Game::init(const char* title, int width, int height) {
     return true;
 }
 
-void Game::handleEvents() {
-    SDL_Event event;
-    while (SDL_PollEvent(&event)) {
-        if (event.type == SDL_QUIT) {
-            isRunning = false;
-        }
+bool Game::startRecording(const char* path) {
+    // Toute la session enregistrée utilise la même graine
+    if (!fixedSeed) {
+        setSeed(Simulation::makeRunSeed());
+    }
+    if (!recorder.open(path, runSeed)) {
+        return false;
+    }
+    recordPath = path;
+    return true;
+}
 
-        if (!gameStarted) {
-            // Gérer les entrées du menu
-            menu->handleInput(event);
-
-            // Vérifier si le jeu doit démarrer
-            if (menu->shouldStartNewGame()) {
-                gameStarted = true;
-                inRoom = true;
-                currentLevel = 1;
-                totalScore = 0; // Réinitialiser le score total
-                totalTime = 0.0f; // Réinitialiser le temps total
-                playerLives = 3; // Réinitialiser les vies
-                playerHealth = 12; // 3 cœurs × 4 quarts = 12
-                invincibilityFrames = 0;
-                gameOver = false; // Réinitialiser le game over
-                menu->resetFlags();
-
-                // Réinitialiser le jeu pour une nouvelle partie
-                // Placer le joueur dans la zone de départ (à gauche)
-                player = std::make_unique<Player>(80, windowHeight / 2);
-
-                // Créer la première salle avec la difficulté choisie
-                currentRoom = std::make_unique<Room>(windowWidth, windowHeight, currentLevel, menu->getDifficulty());
-
-                // Pas d'ennemis dans le mode salle
-                enemies.clear();
-
-                // Fondu sortant de la musique du menu puis démarrer la musique de gameplay
-                AudioManager::getInstance().fadeOutMusic(500); // 500ms de fondu
-                SDL_Delay(500); // Attendre la fin du fondu
-                AudioManager::getInstance().playMusic(MusicTrack::GAMEPLAY, -1); // -1 = boucle infinie
-            } else if (menu->shouldContinueGame()) {
-                gameStarted = true;
-                menu->resetFlags();
-                // Continuer avec l'état actuel du jeu
-            } else if (menu->shouldQuit()) {
-                isRunning = false;
-            }
-        } else {
-            // Gérer les entrées du jeu
-            player->handleEvent(event);
-
-            if (event.type == SDL_KEYDOWN) {
-                if (event.key.keysym.sym == SDLK_ESCAPE) {
-                    // Retour au menu
-                    gameStarted = false;
-                    menu->setState(MenuState::MAIN_MENU);
-                    menu->resetToMainMenu();
-                    // Fondu sortant de la musique de gameplay puis relancer la musique du menu
-                    AudioManager::getInstance().fadeOutMusic(500); // 500ms de fondu
-                    SDL_Delay(500); // Attendre la fin du fondu
-                    AudioManager::getInstance().playMusic(MusicTrack::MENU, -1);
-                }
-            }
-        }
+bool Game::setTickRate(int rate) {
+    if (rate <= 0 || rate > SIMULATION_RATE || SIMULATION_RATE % rate != 0) {
+        std::cerr << "Erreur: La cadence doit diviser " << SIMULATION_RATE << " (reçu " << rate << ")" << std::endl;
+        return false;
     }
+    tickRate = rate;
+    substeps = SIMULATION_RATE / rate;
+    pacer.setTargetRate(rate);
+    return true;
 }
 
-void Game::update() {
-    if (!gameStarted) {
-        // Mettre à jour le menu
-        menu->update();
+void Game::applyVsyncRefreshRate() {
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) != 0 || !(info.flags & SDL_RENDERER_PRESENTVSYNC)) {
+        std::cout << "Synchronisation verticale indisponible, cadence mesurée" << std::endl;
         return;
     }
 
-    player->handleInput();
-    player->update();
+    // Fréquence de l'écran de la fenêtre ; 0 si le pilote ne la donne pas
+    SDL_DisplayMode mode;
+    int refreshRate = 0;
+    if (SDL_GetWindowDisplayMode(window, &mode) == 0) {
+        refreshRate = mode.refresh_rate;
+    }
+    if (refreshRate == 0 && SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(window), &mode) == 0) {
+        refreshRate = mode.refresh_rate;
+    }
 
-    Vector2D playerPos = player->getPosition();
+    // Écran à une autre fréquence (144 Hz, 50 Hz...) : le pacer garde la
+    // cadence de la boucle, la présentation s'aligne sur l'image suivante
+    pacer.setVsyncRefreshRate(refreshRate);
+    if (refreshRate > 0) {
+        std::cout << "Synchronisation verticale: écran à " << refreshRate << " Hz" << std::endl;
+    } else {
+        std::cout << "Synchronisation verticale: fréquence de l'écran inconnue" << std::endl;
+    }
+}
 
-    // Bloquer le mouvement vers l'étoile électrique APRÈS tous les mouvements du joueur
-    if (inRoom && currentRoom) {
-        player->blockMovementTowards(currentRoom->getElectricStarPos(), currentRoom->getElectricStarRadius());
+bool Game::startReplay(const char* path) {
+    if (!replay.open(path)) {
+        return false;
+    }
+    setSeed(replay.getSeed());
+    return true;
+}
 
-        // En mode difficile, bloquer aussi le mouvement vers l'étoile satellite
-        if (currentRoom->getDifficulty() == Difficulty::HARD) {
-            player->blockMovementTowards(currentRoom->getSatelliteStarPos(), currentRoom->getElectricStarRadius());
-        }
+void Game::handleEvents() {
+    PROFILE_SCOPE(ProfilePhase::EVENTS);
 
-        playerPos = player->getPosition(); // Mettre à jour la position après le blocage
-    }
+    input.clear();
+    events.clear();
 
-    if (inRoom && currentRoom) {
-        // Mettre à jour la salle (timer, particules, animations)
-        currentRoom->update(1.0f / 60.0f); // deltaTime approximatif
+    SDL_Event event;
+    while (SDL_PollEvent(&event)) {
+        handleWindowEvent(event);
 
-        // Démarrer le timer si le joueur quitte la zone de départ
-        static bool hasStarted = false;
-        if (!hasStarted && playerPos.x > 100) {
-            currentRoom->startTimer();
-            hasStarted = true;
+        // Seuls les appuis de touche sont lus par le menu et le joueur.
+        // Pendant un replay, le clavier réel est ignoré.
+        if (event.type == SDL_KEYDOWN && !replay.isActive()) {
+            input.addEvent(event.type, event.key.keysym.sym);
         }
+    }
 
-        // Vérifier si le joueur est tombé dans un trou (seulement s'il est au sol)
-        if (player->getIsGrounded() && currentRoom->isPlayerInHole(playerPos, player->getRadius()) && !gameOver) {
-            // Perdre une vie complète (4 quarts de cœur)
-            playerHealth -= 4;
-            if (playerHealth < 0) playerHealth = 0;
-            playerLives = (playerHealth + 3) / 4;
-
-            if (playerHealth <= 0) {
-                gameOver = true;
-                currentRoom->stopTimer();
-                // Sauvegarder le score si c'est un nouveau record (score total + score du niveau actuel)
-                int finalScore = totalScore + currentRoom->getScore();
-                ScoreManager::getInstance().saveHighScore(finalScore, menu->getDifficulty());
-            }
-            // Réinitialiser le joueur à la position de départ
-            player = std::make_unique<Player>(80, windowHeight / 2);
-            // Réinitialiser l'invincibilité
-            invincibilityFrames = invincibilityDuration;
-            // Ne PAS réinitialiser hasStarted - le timer continue
+    if (replay.isActive()) {
+        if (!replay.nextFrame(input)) {
+            std::cout << "Fin du replay (" << replay.getFrameCount() << " frames)" << std::endl;
+            isRunning = false;
+            return;
         }
+    } else {
+        input.heldKeys = readHeldKeys();
+    }
 
-        // Vérifier si le joueur a atteint la fin de la salle
-        if (currentRoom->hasReachedEnd(playerPos) && !currentRoom->isCelebrating() && !gameOver) {
-            // Arrêter le timer et créer l'explosion de fête
-            currentRoom->stopTimer();
-            currentRoom->createCelebrationParticles(playerPos);
-        }
+    recorder.recordFrame(input);
 
-        // Si la célébration est terminée, passer au niveau suivant
-        if (currentRoom->isCelebrating() && currentRoom->getScore() >= 0 && !gameOver) {
-            static float celebrationTimer = 0.0f;
-            celebrationTimer += 1.0f / 60.0f;
-
-            if (celebrationTimer > 2.0f) { // Attendre 2 secondes
-                celebrationTimer = 0.0f;
-                hasStarted = false;
-
-                // Ajouter le score et le temps du niveau actuel au total
-                totalScore += currentRoom->getScore();
-                totalTime += currentRoom->getElapsedTime();
-
-                // Passer au niveau suivant
-                currentLevel++;
-
-                // Réinitialiser le joueur à la position de départ
-                player = std::make_unique<Player>(80, windowHeight / 2);
-
-                // Créer la salle suivante
-                currentRoom = std::make_unique<Room>(windowWidth, windowHeight, currentLevel, menu->getDifficulty());
-
-                // Créer des ennemis à partir du niveau 2
-                enemies.clear();
-                if (currentLevel >= 2) {
-                    int numEnemies = 1 + (currentLevel - 2); // 1 ennemi au niveau 2, 2 au niveau 3, etc.
-                    if (numEnemies > 4) numEnemies = 4; // Maximum 4 ennemis
-
-                    for (int i = 0; i < numEnemies; i++) {
-                        // Positionner les ennemis dans la partie droite de la salle
-                        float enemyX = 400 + (std::rand() % 300);
-                        float enemyY = 100 + (std::rand() % 400);
-                        enemies.push_back(std::make_unique<Enemy>(enemyX, enemyY));
-                    }
-                }
-            }
-        }
+    simulation->processEvents(input, events);
 
-        // Mettre à jour les ennemis dans la salle
-        for (auto& enemy : enemies) {
-            enemy->update(playerPos, currentRoom.get());
-        }
+    if (events.jumped) {
+        AudioManager::getInstance().playSound(SoundEffect::JUMP);
+    }
+    if (events.attacked) {
+        AudioManager::getInstance().playSound(SoundEffect::ATTACK);
+    }
+    if (events.newGame) {
+        // Graine affichée pour pouvoir rejouer la même partie
+        std::cout << "Graine de la partie : " << simulation->getRunSeed() << std::endl;
+
+        // Fondu sortant de la musique du menu puis démarrer la musique de gameplay
+        AudioManager::getInstance().fadeOutMusic(500); // 500ms de fondu
+        SDL_Delay(500); // Attendre la fin du fondu
+        AudioManager::getInstance().playMusic(MusicTrack::GAMEPLAY, -1); // -1 = boucle infinie
+    }
+    if (events.backToMenu) {
+        // Fondu sortant de la musique de gameplay puis relancer la musique du menu
+        AudioManager::getInstance().fadeOutMusic(500); // 500ms de fondu
+        SDL_Delay(500); // Attendre la fin du fondu
+        AudioManager::getInstance().playMusic(MusicTrack::MENU, -1);
+    }
+    if (events.stateSaved && !replay.isActive()) {
+        // Écriture sur disque : frame de transition
+        AllocationTracker::markTransition();
+        writeSnapshotFile(QUICK_SAVE_FILE, *simulation->getQuickSave());
+    }
+    if (events.quit) {
+        isRunning = false;
+    }
+}
 
-        // Détection de collision entre l'attaque du joueur et les ennemis
-        if (player->isAttacking()) {
-            Direction playerDir = player->getDirection();
-            int attackRange = player->getAttackRange();
-
-            for (auto& enemy : enemies) {
-                if (enemy->isDead()) continue;
-
-                Vector2D enemyPos = enemy->getPosition();
-                float dx = enemyPos.x - playerPos.x;
-                float dy = enemyPos.y - playerPos.y;
-
-                // Vérifier si l'ennemi est dans la direction de l'attaque
-                bool inAttackZone = false;
-
-                switch (playerDir) {
-                    case Direction::UP:
-                        inAttackZone = (dy < 0 && std::abs(dy) <= attackRange && std::abs(dx) <= 15);
-                        break;
-                    case Direction::DOWN:
-                        inAttackZone = (dy > 0 && std::abs(dy) <= attackRange && std::abs(dx) <= 15);
-                        break;
-                    case Direction::LEFT:
-                        inAttackZone = (dx < 0 && std::abs(dx) <= attackRange && std::abs(dy) <= 15);
-                        break;
-                    case Direction::RIGHT:
-                        inAttackZone = (dx > 0 && std::abs(dx) <= attackRange && std::abs(dy) <= 15);
-                        break;
-                    case Direction::UP_LEFT:
-                        inAttackZone = (dx < 0 && dy < 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                    case Direction::UP_RIGHT:
-                        inAttackZone = (dx > 0 && dy < 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                    case Direction::DOWN_LEFT:
-                        inAttackZone = (dx < 0 && dy > 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                    case Direction::DOWN_RIGHT:
-                        inAttackZone = (dx > 0 && dy > 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                }
-
-                if (inAttackZone) {
-                    enemy->takeDamage(1, playerPos);
-                }
-            }
-        }
+void Game::handleWindowEvent(const SDL_Event& event) {
+    if (event.type == SDL_QUIT) {
+        isRunning = false;
+    }
 
-        // Décrémenter les frames d'invincibilité
-        if (invincibilityFrames > 0) {
-            invincibilityFrames--;
+    if (event.type == SDL_WINDOWEVENT) {
+        switch (event.window.event) {
+            case SDL_WINDOWEVENT_MINIMIZED:
+            case SDL_WINDOWEVENT_HIDDEN:
+                windowHidden = true;
+                break;
+            case SDL_WINDOWEVENT_SHOWN:
+            case SDL_WINDOWEVENT_RESTORED:
+            case SDL_WINDOWEVENT_MAXIMIZED:
+                windowHidden = false;
+                break;
+            case SDL_WINDOWEVENT_FOCUS_GAINED:
+                windowFocused = true;
+                break;
+            case SDL_WINDOWEVENT_FOCUS_LOST:
+                windowFocused = false;
+                unfocusedFrames = 0;
+                break;
         }
+    }
+
+    // Contenu des textures cibles perdu (Direct3D, changement de mode) :
+    // le HUD et les couches du menu seront redessinés
+    if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+        hud.invalidate();
+        simulation->getMenu().invalidateLayers();
+    }
+}
+
+bool Game::isIdle() const {
+    if (windowHidden) return true;
+
+    // Un replay avance sans événement SDL : jamais d'attente
+    if (replay.isActive() || simulation->isGameStarted()) return false;
+    return !simulation->getMenu().isAnimated();
+}
 
-        // Mettre à jour l'état d'invincibilité du joueur
-        player->setInvincible(invincibilityFrames > 0);
-
-        // Détection de collision entre le joueur et les ennemis
-        for (const auto& enemy : enemies) {
-            if (enemy->isDead()) continue;
-
-            Vector2D enemyPos = enemy->getPosition();
-            float dx = enemyPos.x - playerPos.x;
-            float dy = enemyPos.y - playerPos.y;
-            float distance = std::sqrt(dx * dx + dy * dy);
-
-            // Collision si la distance entre centres < somme des rayons
-            if (distance < (player->getRadius() + enemy->getRadius())) {
-                if (invincibilityFrames == 0 && !gameOver) {
-                    // Perdre 1/4 de cœur
-                    playerHealth--;
-
-                    // Mettre à jour playerLives pour l'affichage
-                    playerLives = (playerHealth + 3) / 4; // Arrondir au cœur supérieur
-
-                    if (playerHealth <= 0) {
-                        playerHealth = 0;
-                        playerLives = 0;
-                        gameOver = true;
-                        if (currentRoom) {
-                            currentRoom->stopTimer();
-                        }
-                        // Sauvegarder le score si c'est un nouveau record (score total + score du niveau actuel)
-                        int finalScore = totalScore + (currentRoom ? currentRoom->getScore() : 0);
-                        ScoreManager::getInstance().saveHighScore(finalScore, menu->getDifficulty());
-                    }
-
-                    // Appliquer un knockback (repousser le joueur)
-                    player->applyKnockback(enemyPos);
-
-                    // Activer l'invincibilité
-                    invincibilityFrames = invincibilityDuration;
-
-                    // Ne vérifier qu'une collision par frame
-                    break;
-                }
+void Game::waitWhileIdle() {
+    while (isRunning && isIdle()) {
+        // Le temps passé à attendre n'est pas un intervalle entre frames
+        pacer.restart();
+
+        if (windowHidden) {
+            // Pause : les événements sont consommés ici, sans frame. Le
+            // clavier n'arrive pas à une fenêtre cachée ; seuls comptent
+            // fermeture et changements de fenêtre.
+            SDL_Event event;
+            if (SDL_WaitEventTimeout(&event, IDLE_WAIT_TIMEOUT_MS)) {
+                handleWindowEvent(event);
             }
+        } else if (SDL_WaitEventTimeout(nullptr, IDLE_WAIT_TIMEOUT_MS)) {
+            // Écran fixe : l'événement reste dans la file pour handleEvents
+            return;
         }
+    }
+}
 
-        // Vérifier collision avec l'étoile électrique pour les dégâts
-        if (currentRoom->isPlayerTouchingElectricStar(playerPos, player->getRadius())) {
-            // Perdre 1/4 de cœur seulement si pas invincible
-            if (invincibilityFrames == 0) {
-                // Appliquer le recul au premier contact
-                player->applyKnockback(currentRoom->getElectricStarPos());
-
-                playerHealth--;
-
-                // Mettre à jour playerLives pour l'affichage
-                playerLives = (playerHealth + 3) / 4;
-
-                if (playerHealth <= 0) {
-                    playerHealth = 0;
-                    playerLives = 0;
-                    gameOver = true;
-                    if (currentRoom) {
-                        currentRoom->stopTimer();
-                    }
-                    // Sauvegarder le score si c'est un nouveau record
-                    int finalScore = totalScore + (currentRoom ? currentRoom->getScore() : 0);
-                    ScoreManager::getInstance().saveHighScore(finalScore, menu->getDifficulty());
-                }
-
-                // Activer l'invincibilité
-                invincibilityFrames = invincibilityDuration;
-            }
+bool Game::nextSubstepInput() {
+    // Les événements clavier du tick sont traités au premier sous-pas ;
+    // les suivants reprennent les touches maintenues. Chaque sous-pas est
+    // enregistré comme une frame : le replay ne dépend pas de la cadence.
+    if (replay.isActive()) {
+        if (!replay.nextFrame(input)) {
+            std::cout << "Fin du replay (" << replay.getFrameCount() << " frames)" << std::endl;
+            isRunning = false;
+            return false;
         }
     } else {
-        // Mode exploration avec ennemis (ancien mode)
-        // Mettre à jour les ennemis
-        for (auto& enemy : enemies) {
-            enemy->update(playerPos, nullptr);
-        }
+        input.eventCount = 0;
+    }
 
-        // Détection de collision entre l'attaque du joueur et les ennemis
-        if (player->isAttacking()) {
-            Direction playerDir = player->getDirection();
-            int attackRange = player->getAttackRange();
-
-            for (auto& enemy : enemies) {
-                Vector2D enemyPos = enemy->getPosition();
-                float dx = enemyPos.x - playerPos.x;
-                float dy = enemyPos.y - playerPos.y;
-
-                // Vérifier si l'ennemi est dans la direction de l'attaque
-                bool inAttackZone = false;
-
-                switch (playerDir) {
-                    case Direction::UP:
-                        inAttackZone = (dy < 0 && std::abs(dy) <= attackRange && std::abs(dx) <= 15);
-                        break;
-                    case Direction::DOWN:
-                        inAttackZone = (dy > 0 && std::abs(dy) <= attackRange && std::abs(dx) <= 15);
-                        break;
-                    case Direction::LEFT:
-                        inAttackZone = (dx < 0 && std::abs(dx) <= attackRange && std::abs(dy) <= 15);
-                        break;
-                    case Direction::RIGHT:
-                        inAttackZone = (dx > 0 && std::abs(dx) <= attackRange && std::abs(dy) <= 15);
-                        break;
-                    case Direction::UP_LEFT:
-                        inAttackZone = (dx < 0 && dy < 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                    case Direction::UP_RIGHT:
-                        inAttackZone = (dx > 0 && dy < 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                    case Direction::DOWN_LEFT:
-                        inAttackZone = (dx < 0 && dy > 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                    case Direction::DOWN_RIGHT:
-                        inAttackZone = (dx > 0 && dy > 0 && std::abs(dx) <= attackRange && std::abs(dy) <= attackRange && std::abs(std::abs(dx) - std::abs(dy)) <= 20);
-                        break;
-                }
-
-                if (inAttackZone) {
-                    enemy->takeDamage(1, playerPos);
-                }
-            }
+    recorder.recordFrame(input);
+    return true;
+}
+
+void Game::recordGameOver() {
+    // Sauvegarde du score sur disque : frame de transition
+    AllocationTracker::markTransition();
+
+    Difficulty difficulty = simulation->getDifficulty();
+    if (!replay.isActive()) {
+        // Sauvegarder le score si c'est un nouveau record
+        ScoreManager::getInstance().saveHighScore(events.finalScore, difficulty);
+    }
+    if (recorder.isActive()) {
+        // Score annoncé, vérifiable en rejouant l'enregistrement
+        ScoreRecord record;
+        record.score = events.finalScore;
+        record.difficulty = difficulty;
+        sessionScores.push_back(record);
+    }
+}
+
+void Game::update() {
+    PROFILE_SCOPE(ProfilePhase::UPDATE);
+
+    if (!isRunning) return;
+
+    for (int step = 0; step < substeps; step++) {
+        if (step > 0) {
+            if (!nextSubstepInput()) return;
+            simulation->processEvents(input, events);
         }
 
-        // Supprimer les ennemis morts
-        enemies.erase(
-            std::remove_if(enemies.begin(), enemies.end(),
-                [](const std::unique_ptr<Enemy>& e) { return e->isDead(); }),
-            enemies.end()
-        );
+        simulation->update(input, events);
+
+        if (events.gameOver) {
+            recordGameOver();
+            events.gameOver = false;
+        }
     }
 }
 
+bool Game::isSteadyGameplay() const {
+    return simulation && simulation->isSteadyGameplay();
+}
+
+int Game::getTotalScore() const {
+    return simulation ? simulation->getWorld().getTotalScore() : 0;
+}
+
+float Game::getTotalTime() const {
+    return simulation ? simulation->getWorld().getTotalTime() : 0.0f;
+}
+
 void Game::createLightTexture() {
     // Créer une texture de la taille de l'écran pour le masque de lumière
     lightTexture = SDL_CreateTexture(renderer,
@@ -478,6 +430,8 @@ void Game::createLightTexture() {
 }
 
 void Game::drawPlayerLight(int playerX, int playerY) {
+    PROFILE_SCOPE(ProfilePhase::PLAYER_LIGHT);
+
     // Dessiner sur la texture (une seule fois par frame)
     SDL_SetRenderTarget(renderer, lightTexture);
 
@@ -516,13 +470,13 @@ void Game::drawPlayerLight(int playerX, int playerY) {
     }
 
     // Dessiner les auras des ennemis
-    for (const auto& enemy : enemies) {
-        if (enemy->isDead()) continue;
+    for (const auto& enemy : simulation->getWorld().getEnemies()) {
+        if (enemy.isDead()) continue;
 
-        Vector2D enemyPos = enemy->getPosition();
+        Vector2D enemyPos = enemy.getPosition();
         int enemyX = static_cast<int>(enemyPos.x);
         int enemyY = static_cast<int>(enemyPos.y);
-        int enemyLightRadius = enemy->getLightRadius();
+        int enemyLightRadius = enemy.getLightRadius();
 
         int numCircles = 15;  // Réduit de 25 à 15 pour de meilleures performances
         for (int i = numCircles; i >= 0; i--) {
@@ -557,32 +511,46 @@ void Game::drawPlayerLight(int playerX, int playerY) {
 }
 
 void Game::render() {
+    // Fenêtre sans focus : la frame est jouée mais pas toujours dessinée
+    framePresented = false;
+    if (!windowFocused && unfocusedFrames++ % UNFOCUSED_RENDER_STRIDE != 0) {
+        return;
+    }
+
+    PROFILE_BEGIN(ProfilePhase::RENDER);
+
     // Fond noir
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
 
-    if (!gameStarted) {
+    World& world = simulation->getWorld();
+    Player& player = world.getPlayer();
+    std::vector<Enemy>& enemies = world.getEnemies();
+
+    if (!simulation->isGameStarted()) {
         // Afficher le menu
-        menu->render(renderer);
-    } else if (inRoom && currentRoom) {
+        simulation->getMenu().render(renderer);
+    } else if (world.isInRoom()) {
         // Mode salle : afficher la salle
-        currentRoom->render(renderer);
+        Room* room = world.getRoom();
+        room->render(renderer);
 
         // Appliquer le masque de lumière avec SDL_BLENDMODE_MOD
         // Cela multiplie les couleurs : noir (0,0,0) cache tout, blanc (255,255,255) révèle
-        Vector2D playerPos = player->getPosition();
+        Vector2D playerPos = player.getPosition();
         drawPlayerLight(static_cast<int>(playerPos.x), static_cast<int>(playerPos.y));
 
         // Rendre les ennemis APRÈS l'effet de lumière pour qu'ils soient visibles
         for (auto& enemy : enemies) {
-            enemy->render(renderer);
+            enemy.render(renderer);
         }
 
         // Rendre le joueur APRÈS pour qu'il soit visible
-        player->render(renderer);
+        player.render(renderer);
 
         // Afficher le HUD (score et temps) en premier plan, après l'effet de lumière
-        currentRoom->renderHUD(renderer, totalScore, totalTime, playerHealth, gameOver);
+        room->renderHUD(renderer, hud, world.getTotalScore(), world.getTotalTime(),
+                        world.getPlayerHealth(), world.isGameOver());
     } else {
         // Mode exploration (ancien mode)
         // Rendre la carte
@@ -590,28 +558,57 @@ void Game::render() {
 
         // Rendre les ennemis
         for (auto& enemy : enemies) {
-            enemy->render(renderer);
+            enemy.render(renderer);
         }
 
         // Appliquer le masque de lumière avec SDL_BLENDMODE_MOD
         // Cela multiplie les couleurs : noir (0,0,0) cache tout, blanc (255,255,255) révèle
-        Vector2D playerPos = player->getPosition();
+        Vector2D playerPos = player.getPosition();
         drawPlayerLight(static_cast<int>(playerPos.x), static_cast<int>(playerPos.y));
 
         // Rendre le joueur APRÈS pour qu'il soit visible
-        player->render(renderer);
+        player.render(renderer);
     }
 
     SDL_RenderPresent(renderer);
+    framePresented = true;
 
-    // Contrôle du framerate
-    SDL_Delay(frameDelay);
+    PROFILE_END(ProfilePhase::RENDER);
+}
+
+void Game::waitForNextFrame() {
+    // Contrôle du framerate : attente du reste de la période seulement.
+    // Une frame sautée n'est pas retenue par la vsync : le pacer attend.
+    pacer.waitForNextFrame(framePresented);
 }
 
 void Game::clean() {
+    // Régularité des frames de la session (une seule fois : clean est
+    // rappelé par le destructeur)
+    if (renderer) {
+        pacer.printReport();
+    }
+
+    // Terminer le fichier de replay en cours d'enregistrement,
+    // avec à côté les scores annoncés de la session
+    if (recorder.isActive()) {
+        recorder.close();
+        ScoreManager::saveRecords(recordPath + ".scores", sessionScores);
+    }
+
+    if (simulation) {
+        simulation->getMenu().unwatchHighScores();
+    }
+
+    // Libérer les salles avant d'arrêter le thread qui les prépare
+    simulation.reset();
+    roomBuilder.stop();
+
     // Nettoyer l'AudioManager
     AudioManager::getInstance().cleanup();
 
+    StarSpriteSheet::getInstance().cleanup();
+    hud.release();
     if (lightTexture) {
         SDL_DestroyTexture(lightTexture);
         lightTexture = nullptr;
@@ -0,0 +1,173 @@
+#include "HazardSystem.hpp"
+#include "SimMath.hpp"
+#include <cmath>
+
+namespace {
+
+// Avancement de 0 à 1 puis retour à 0 sur un tour de phase, sans à-coup
+// aux extrémités (patrouille et pulsation)
+SimReal pingPong(float phase) {
+    return (SimReal(1.0f) - simCos(SimReal(phase))) * SimReal(0.5f);
+}
+
+// Position et rayon d'un danger d'après sa phase
+void place(HazardArrays& data, int i) {
+    switch (static_cast<HazardKind>(data.kind[i])) {
+        case HazardKind::STATIC:
+            break;
+        case HazardKind::ORBIT: {
+            SimReal angle = data.phase[i];
+            SimReal orbitRadius = data.extent[i];
+            data.x[i] = simFloat(SimReal(data.anchorX[i]) + orbitRadius * simCos(angle));
+            data.y[i] = simFloat(SimReal(data.anchorY[i]) + orbitRadius * simSin(angle));
+            break;
+        }
+        case HazardKind::PATROL: {
+            SimReal t = pingPong(data.phase[i]);
+            data.x[i] = simFloat(SimReal(data.anchorX[i]) + SimReal(data.targetX[i] - data.anchorX[i]) * t);
+            data.y[i] = simFloat(SimReal(data.anchorY[i]) + SimReal(data.targetY[i] - data.anchorY[i]) * t);
+            break;
+        }
+        case HazardKind::PULSE:
+            data.radius[i] = simFloat(SimReal(data.baseRadius[i]) + SimReal(data.extent[i]) * pingPong(data.phase[i]));
+            break;
+    }
+}
+
+} // namespace
+
+HazardSystem::HazardSystem(int screenWidth, int screenHeight)
+    : grid(static_cast<float>(screenWidth), static_cast<float>(screenHeight), HazardLimits::CELL_SIZE,
+           HazardLimits::MAX_HAZARDS, HazardLimits::MAX_RADIUS),
+      gridDirty(true) {
+    clear();
+}
+
+HazardSystem::~HazardSystem() {}
+
+void HazardSystem::clear() {
+    data = HazardArrays();
+    gridDirty = true;
+}
+
+int HazardSystem::add(HazardKind kind, const Vector2D& anchor, float radius, float speed) {
+    if (data.count >= HazardLimits::MAX_HAZARDS) {
+        return -1;
+    }
+
+    int i = data.count++;
+    data.kind[i] = static_cast<uint8_t>(kind);
+    data.x[i] = anchor.x;
+    data.y[i] = anchor.y;
+    data.radius[i] = radius;
+    data.baseRadius[i] = radius;
+    data.anchorX[i] = anchor.x;
+    data.anchorY[i] = anchor.y;
+    data.targetX[i] = anchor.x;
+    data.targetY[i] = anchor.y;
+    data.extent[i] = 0.0f;
+    data.phase[i] = 0.0f;
+    data.speed[i] = speed;
+    gridDirty = true;
+    return i;
+}
+
+int HazardSystem::addStatic(const Vector2D& position, float radius) {
+    return add(HazardKind::STATIC, position, radius, 0.0f);
+}
+
+int HazardSystem::addOrbit(const Vector2D& anchor, float orbitRadius, float speed, float radius) {
+    int i = add(HazardKind::ORBIT, anchor, radius, speed);
+    if (i >= 0) {
+        data.extent[i] = orbitRadius;
+        place(data, i);
+    }
+    return i;
+}
+
+int HazardSystem::addPatrol(const Vector2D& from, const Vector2D& to, float speed, float radius) {
+    int i = add(HazardKind::PATROL, from, radius, speed);
+    if (i >= 0) {
+        data.targetX[i] = to.x;
+        data.targetY[i] = to.y;
+    }
+    return i;
+}
+
+int HazardSystem::addPulse(const Vector2D& position, float baseRadius, float amplitude, float speed) {
+    int i = add(HazardKind::PULSE, position, baseRadius, speed);
+    if (i >= 0) {
+        data.extent[i] = amplitude;
+    }
+    return i;
+}
+
+void HazardSystem::update() {
+    // Première passe, identique pour tous : avancer les phases
+    // (vitesse nulle pour les dangers immobiles)
+    for (int i = 0; i < data.count; i++) {
+        data.phase[i] += data.speed[i];
+        if (data.phase[i] > 2 * M_PI) {
+            data.phase[i] -= 2 * M_PI;
+        }
+    }
+
+    // Seconde passe : positions et rayons
+    for (int i = 0; i < data.count; i++) {
+        place(data, i);
+    }
+
+    gridDirty = true;
+}
+
+const SpatialGrid& HazardSystem::broadphase() const {
+    if (gridDirty) {
+        grid.build(data.count, data.x, data.y, data.radius);
+        gridDirty = false;
+    }
+    return grid;
+}
+
+int HazardSystem::queryPath(const Vector2D& from, const Vector2D& to, float radius, int* out, int maxOut) const {
+    return broadphase().query(std::fmin(from.x, to.x) - radius, std::fmin(from.y, to.y) - radius,
+                              std::fmax(from.x, to.x) + radius, std::fmax(from.y, to.y) + radius,
+                              out, maxOut);
+}
+
+int HazardSystem::findContact(const Vector2D& position, float radius) const {
+    int candidates[HazardLimits::MAX_HAZARDS];
+    int found = broadphase().queryCircle(position.x, position.y, radius, candidates, HazardLimits::MAX_HAZARDS);
+
+    for (int k = 0; k < found; k++) {
+        int i = candidates[k];
+        // Comparer les carrés des distances pour éviter sqrt()
+        float contactDistance = radius + data.radius[i];
+        float dx = position.x - data.x[i];
+        float dy = position.y - data.y[i];
+        if (dx * dx + dy * dy < contactDistance * contactDistance) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool HazardSystem::isValid(const HazardArrays& arrays) {
+    if (arrays.count < 0 || arrays.count > HazardLimits::MAX_HAZARDS) {
+        return false;
+    }
+    for (int i = 0; i < arrays.count; i++) {
+        if (arrays.kind[i] > static_cast<uint8_t>(HazardKind::PULSE)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HazardSystem::loadState(const HazardArrays& snapshot) {
+    if (!isValid(snapshot)) {
+        return false;
+    }
+    data = snapshot;
+    gridDirty = true;
+    return true;
+}
@@ -0,0 +1,129 @@
+#include "HudCache.hpp"
+#include <iostream>
+
+namespace {
+
+bool supportsTargetTextures(SDL_Renderer* renderer) {
+    SDL_RendererInfo info;
+    return SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_TARGETTEXTURE);
+}
+
+} // namespace
+
+HudWidget::HudWidget()
+    : texture(nullptr),
+      previousTarget(nullptr),
+      previousViewport{0, 0, 0, 0},
+      x(0),
+      y(0),
+      width(0),
+      height(0),
+      value(0),
+      valid(false),
+      direct(false) {}
+
+HudWidget::~HudWidget() {
+    release();
+}
+
+bool HudWidget::beginRedraw(SDL_Renderer* renderer, int newValue, int newX, int newY, int newWidth, int newHeight) {
+    x = newX;
+    y = newY;
+    if (direct) {
+        width = newWidth;
+        height = newHeight;
+        return beginDirect(renderer);
+    }
+    if (valid && newValue == value && newWidth == width && newHeight == height) {
+        return false;
+    }
+
+    value = newValue;
+    valid = true;
+
+    if (!texture || newWidth != width || newHeight != height) {
+        if (texture) {
+            SDL_DestroyTexture(texture);
+            texture = nullptr;
+        }
+        width = newWidth;
+        height = newHeight;
+        if (!supportsTargetTextures(renderer)) {
+            direct = true;
+            return beginDirect(renderer);
+        }
+        texture = SDL_CreateTexture(renderer,
+                                    SDL_PIXELFORMAT_RGBA8888,
+                                    SDL_TEXTUREACCESS_TARGET,
+                                    width, height);
+        if (!texture) {
+            std::cerr << "Erreur SDL_CreateTexture (HUD): " << SDL_GetError() << std::endl;
+            direct = true;
+            return beginDirect(renderer);
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    }
+
+    previousTarget = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, texture) != 0) {
+        std::cerr << "Erreur SDL_SetRenderTarget (HUD): " << SDL_GetError() << std::endl;
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+        direct = true;
+        return beginDirect(renderer);
+    }
+
+    // Fond transparent ; le tracé sans mélange écrit des pixels opaques
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    return true;
+}
+
+bool HudWidget::beginDirect(SDL_Renderer* renderer) {
+    // Origine du tracé ramenée au coin de l'élément, comme dans la texture
+    SDL_RenderGetViewport(renderer, &previousViewport);
+    SDL_Rect area = {x, y, width, height};
+    SDL_RenderSetViewport(renderer, &area);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+void HudWidget::endRedraw(SDL_Renderer* renderer) {
+    if (direct) {
+        SDL_RenderSetViewport(renderer, &previousViewport);
+        return;
+    }
+    SDL_SetRenderTarget(renderer, previousTarget);
+    previousTarget = nullptr;
+}
+
+void HudWidget::draw(SDL_Renderer* renderer) const {
+    if (!texture) return;
+
+    SDL_Rect destination = {x, y, width, height};
+    SDL_RenderCopy(renderer, texture, nullptr, &destination);
+}
+
+void HudWidget::release() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    valid = false;
+    direct = false;
+}
+
+void HudCache::invalidate() {
+    instruction.invalidate();
+    hearts.invalidate();
+    timer.invalidate();
+    score.invalidate();
+}
+
+void HudCache::release() {
+    instruction.release();
+    hearts.release();
+    timer.release();
+    score.release();
+}
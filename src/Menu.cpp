@@ -1,7 +1,28 @@
 #include "Menu.hpp"
 #include "ScoreManager.hpp"
+#include "FastMath.hpp"
 #include <cmath>
-#include <string>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// Décalages des composantes verte et bleue de l'arc-en-ciel (2 et 4 radians),
+// en unités de phase : l'addition boucle d'elle-même sur le tour
+const uint32_t RAINBOW_GREEN_SHIFT = FastMath::radiansToPhase(2.0f);
+const uint32_t RAINBOW_BLUE_SHIFT = FastMath::radiansToPhase(4.0f);
+
+// Taille des couches statiques (le menu est mis en page pour 800x600)
+const int LAYER_WIDTH = 800;
+const int LAYER_HEIGHT = 600;
+
+// Position du titre "AMAZING BALL" : 12 caractères de 10 * TITLE_SIZE pixels
+const int TITLE_SIZE = 4;
+const int TITLE_WIDTH = 10 * TITLE_SIZE * 12;
+const int TITLE_X = (800 - TITLE_WIDTH) / 2;
+const int TITLE_Y = 70;
+
+} // namespace
 
 Menu::Menu()
     : state(MenuState::MAIN_MENU),
@@ -12,9 +33,43 @@ Menu::Menu()
       quit(false),
       difficulty(Difficulty::MEDIUM),
       titlePulse(0.0f),
-      titlePulseSpeed(0.05f) {}
+      titlePulseSpeed(0.05f),
+      highScores{0, 0, 0},
+      highScoresRevision(0),
+      watchingHighScores(false) {}
+
+Menu::~Menu() {
+    unwatchHighScores();
+}
 
-Menu::~Menu() {}
+void Menu::watchHighScores() {
+    if (watchingHighScores) return;
+    watchingHighScores = true;
+    onHighScoresChanged(this);
+    ScoreManager::getInstance().addListener(&Menu::onHighScoresChanged, this);
+}
+
+void Menu::unwatchHighScores() {
+    if (!watchingHighScores) return;
+    watchingHighScores = false;
+    ScoreManager::getInstance().removeListener(&Menu::onHighScoresChanged, this);
+}
+
+void Menu::invalidateLayers() {
+    mainLayer.invalidate();
+    difficultyLayer.invalidate();
+    creditsLayer.invalidate();
+    highScoresLayer.invalidate();
+}
+
+void Menu::onHighScoresChanged(void* context) {
+    Menu* menu = static_cast<Menu*>(context);
+    ScoreManager& scores = ScoreManager::getInstance();
+    menu->highScores[0] = scores.getHighScore(Difficulty::EASY);
+    menu->highScores[1] = scores.getHighScore(Difficulty::MEDIUM);
+    menu->highScores[2] = scores.getHighScore(Difficulty::HARD);
+    menu->highScoresRevision++;
+}
 
 void Menu::handleInput(SDL_Event& event) {
     if (event.type == SDL_KEYDOWN) {
@@ -138,7 +193,7 @@ void Menu::drawBorder(SDL_Renderer* renderer, int x, int y, int w, int h) {
     SDL_RenderDrawRect(renderer, &rect);
 }
 
-void Menu::drawText(SDL_Renderer* renderer, const std::string& text, int x, int y,
+void Menu::drawText(SDL_Renderer* renderer, const char* text, int x, int y,
                     int size, bool selected) {
     // Fonction simple pour dessiner du texte pixel art
     // Chaque caractère fait 8x8 pixels de base, multiplié par size
@@ -151,11 +206,13 @@ void Menu::drawText(SDL_Renderer* renderer, const std::string& text, int x, int
     int textWidth = 0;
 
     // Calculer la largeur totale du texte
-    for (size_t i = 0; i < text.length(); i++) {
+    size_t length = std::strlen(text);
+    for (size_t i = 0; i < length; i++) {
         textWidth += charWidth + spacing;
     }
 
-    for (char c : text) {
+    for (size_t i = 0; i < length; i++) {
+        char c = text[i];
         // Dessiner un rectangle pour chaque caractère (style rétro simplifié)
         if (c != ' ') {
             // Couleur du texte
@@ -397,14 +454,16 @@ void Menu::drawText(SDL_Renderer* renderer, const std::string& text, int x, int
 }
 
 void Menu::drawNumber(SDL_Renderer* renderer, int number, int x, int y, int size) {
-    // Convertir le nombre en string
-    std::string numStr = std::to_string(number);
+    // Convertir le nombre en chiffres (tampon local, sans allocation)
+    char numStr[12];
+    std::snprintf(numStr, sizeof(numStr), "%d", number);
 
     int currentX = x;
     int digitWidth = size * 6;
     int digitSpacing = size * 2;
 
-    for (char digit : numStr) {
+    for (const char* it = numStr; *it; ++it) {
+        char digit = *it;
         // Vérifier que c'est bien un chiffre
         if (digit < '0' || digit > '9') {
             // Si ce n'est pas un chiffre, sauter mais ne rien dessiner
@@ -492,10 +551,10 @@ void Menu::renderHighScoresScreen(SDL_Renderer* renderer) {
     int y = 150;
     int spacing = 100;
 
-    // Récupérer les scores
-    int scoreEasy = ScoreManager::getInstance().getHighScore(Difficulty::EASY);
-    int scoreMedium = ScoreManager::getInstance().getHighScore(Difficulty::MEDIUM);
-    int scoreHard = ScoreManager::getInstance().getHighScore(Difficulty::HARD);
+    // Scores recopiés à la dernière notification de ScoreManager
+    int scoreEasy = highScores[0];
+    int scoreMedium = highScores[1];
+    int scoreHard = highScores[2];
 
     // Afficher FACILE
     // "FACILE" = 6 chars, size 2 -> largeur = 10*2*6 = 120px -> x_centre = (800-120)/2 = 340
@@ -504,8 +563,8 @@ void Menu::renderHighScoresScreen(SDL_Renderer* renderer) {
     y += 40;
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // Blanc
     // Calculer la largeur du nombre pour le centrer
-    std::string easyStr = std::to_string(scoreEasy);
-    int easyWidth = easyStr.length() * (3 * 6 + 3 * 2); // size=3: digitWidth=18, digitSpacing=6
+    char easyStr[12];
+    int easyWidth = std::snprintf(easyStr, sizeof(easyStr), "%d", scoreEasy) * (3 * 6 + 3 * 2); // size=3: digitWidth=18, digitSpacing=6
     int easyX = (800 - easyWidth) / 2;
     drawNumber(renderer, scoreEasy, easyX, y, 3);
     y += spacing;
@@ -517,8 +576,8 @@ void Menu::renderHighScoresScreen(SDL_Renderer* renderer) {
     y += 40;
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // Blanc
     // Calculer la largeur du nombre pour le centrer
-    std::string mediumStr = std::to_string(scoreMedium);
-    int mediumWidth = mediumStr.length() * (3 * 6 + 3 * 2);
+    char mediumStr[12];
+    int mediumWidth = std::snprintf(mediumStr, sizeof(mediumStr), "%d", scoreMedium) * (3 * 6 + 3 * 2);
     int mediumX = (800 - mediumWidth) / 2;
     drawNumber(renderer, scoreMedium, mediumX, y, 3);
     y += spacing;
@@ -530,8 +589,8 @@ void Menu::renderHighScoresScreen(SDL_Renderer* renderer) {
     y += 40;
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // Blanc
     // Calculer la largeur du nombre pour le centrer
-    std::string hardStr = std::to_string(scoreHard);
-    int hardWidth = hardStr.length() * (3 * 6 + 3 * 2);
+    char hardStr[12];
+    int hardWidth = std::snprintf(hardStr, sizeof(hardStr), "%d", scoreHard) * (3 * 6 + 3 * 2);
     int hardX = (800 - hardWidth) / 2;
     drawNumber(renderer, scoreHard, hardX, y, 3);
 
@@ -541,151 +600,160 @@ void Menu::renderHighScoresScreen(SDL_Renderer* renderer) {
     drawText(renderer, "ECHAP OU FLECHE GAUCHE POUR RETOUR", 225, 550, 1, false);
 }
 
+void Menu::renderMainLayer(SDL_Renderer* renderer) {
+    // Ombre portée du titre (décalée légèrement en bas à droite)
+    drawText(renderer, "AMAZING BALL", TITLE_X + 3, TITLE_Y + 3, TITLE_SIZE, false);
+
+    // Titre principal. drawText choisit lui-même la couleur de chaque
+    // caractère (gris, blanc si sélectionné) : le titre est fixe et fait
+    // partie de la couche statique
+    drawText(renderer, "AMAZING BALL", TITLE_X, TITLE_Y, TITLE_SIZE, false);
+
+    // Options du menu (toutes centrées)
+    int menuY = 250;
+    int menuSpacing = 70;
+
+    // "JOUER" = 5 chars, size 2 -> largeur = 10*2*5 = 100px -> x_centre = (800-100)/2 = 350
+    drawText(renderer, "JOUER", 350, menuY, 2, selectedOption == 0);
+    // "CREDITS" = 7 chars, size 2 -> largeur = 10*2*7 = 140px -> x_centre = (800-140)/2 = 330
+    drawText(renderer, "CREDITS", 330, menuY + menuSpacing, 2, selectedOption == 1);
+    // "QUITTER" = 7 chars, size 2 -> largeur = 10*2*7 = 140px -> x_centre = (800-140)/2 = 330
+    drawText(renderer, "QUITTER", 330, menuY + menuSpacing * 2, 2, selectedOption == 2);
+
+    // Instructions en bas
+    SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
+    // "FLECHES HAUT BAS   ENTREE POUR VALIDER" = 39 chars, size 1 -> largeur = 10*1*39 = 390px -> x_centre = (800-390)/2 = 205
+    drawText(renderer, "FLECHES HAUT BAS   ENTREE POUR VALIDER", 205, 530, 1, false);
+
+    // Indication pour accéder aux meilleurs scores
+    SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255); // Couleur dorée
+    // "FLECHE DROITE POUR MEILLEURS SCORES" = 36 chars, size 1 -> largeur = 10*1*36 = 360px -> x_centre = (800-360)/2 = 220
+    drawText(renderer, "FLECHE DROITE POUR MEILLEURS SCORES", 220, 550, 1, false);
+}
+
+void Menu::renderDifficultyLayer(SDL_Renderer* renderer) {
+    // Écran de sélection de difficulté
+    // "CHOISIR DIFFICULTE" = 18 chars, size 3 -> largeur = 10*3*18 = 540px -> x_centre = (800-540)/2 = 130
+    drawText(renderer, "CHOISIR DIFFICULTE", 130, 100, 3, false);
+
+    int menuY = 250;
+    int menuSpacing = 80;
+
+    // Options de difficulté (toutes centrées)
+    // "FACILE" = 6 chars, size 2 -> largeur = 10*2*6 = 120px -> x_centre = (800-120)/2 = 340
+    drawText(renderer, "FACILE", 340, menuY, 2, selectedOption == 0);
+    // "MOYEN" = 5 chars, size 2 -> largeur = 10*2*5 = 100px -> x_centre = (800-100)/2 = 350
+    drawText(renderer, "MOYEN", 350, menuY + menuSpacing, 2, selectedOption == 1);
+    // "DIFFICILE" = 9 chars, size 2 -> largeur = 10*2*9 = 180px -> x_centre = (800-180)/2 = 310
+    drawText(renderer, "DIFFICILE", 310, menuY + menuSpacing * 2, 2, selectedOption == 2);
+
+    // Instructions en bas
+    SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
+    // "FLECHES   ENTREE   ECHAP POUR RETOUR" = 37 chars, size 1 -> largeur = 10*1*37 = 370px -> x_centre = (800-370)/2 = 215
+    drawText(renderer, "FLECHES   ENTREE   ECHAP POUR RETOUR", 215, 550, 1, false);
+}
+
+void Menu::renderCreditsLayer(SDL_Renderer* renderer) {
+    // Écran des crédits
+    // Calculer les positions centrées (écran 800px de large)
+    // Format: (charWidth + spacing) * nb_chars = (8*size + 2*size) * nb_chars = 10*size * nb_chars
+
+    // "CREDITS" = 7 chars, size 3 -> largeur = 10*3*7 = 210px -> x_centre = (800-210)/2 = 295
+    drawText(renderer, "CREDITS", 295, 50, 3, false);
+
+    int y = 150;
+    int spacing = 50;
+
+    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
+    // "DEVELOPPEMENT" = 13 chars, size 2 -> largeur = 10*2*13 = 260px -> x_centre = (800-260)/2 = 270
+    drawText(renderer, "DEVELOPPEMENT", 270, y, 2, false);
+    y += spacing;
+    // "BRUNO BOIRIE" = 12 chars, size 1 -> largeur = 10*1*12 = 120px -> x_centre = (800-120)/2 = 340
+    drawText(renderer, "BRUNO BOIRIE", 340, y, 1, false);
+    y += spacing * 2;
+
+    // "GRAPHISMES" = 10 chars, size 2 -> largeur = 10*2*10 = 200px -> x_centre = (800-200)/2 = 300
+    drawText(renderer, "GRAPHISMES", 300, y, 2, false);
+    y += spacing;
+    drawText(renderer, "BRUNO BOIRIE", 340, y, 1, false);
+    y += spacing * 2;
+
+    // "MOTEUR" = 6 chars, size 2 -> largeur = 10*2*6 = 120px -> x_centre = (800-120)/2 = 340
+    drawText(renderer, "MOTEUR", 340, y, 2, false);
+    y += spacing;
+    // "SDL2" = 4 chars, size 1 -> largeur = 10*1*4 = 40px -> x_centre = (800-40)/2 = 380
+    drawText(renderer, "SDL2", 380, y, 1, false);
+
+    // Instruction de retour
+    SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
+    // "APPUYER SUR ECHAP POUR REVENIR" = 30 chars, size 1 -> largeur = 10*1*30 = 300px -> x_centre = (800-300)/2 = 250
+    drawText(renderer, "APPUYER SUR ECHAP POUR REVENIR", 250, 550, 1, false);
+}
+
 void Menu::render(SDL_Renderer* renderer) {
     // Fond noir
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_RenderClear(renderer);
 
     if (state == MenuState::MAIN_MENU) {
-        // Titre du jeu avec taille fixe
-        int titleSize = 4;
-
-        // Calculer la position centrée du titre
-        // "AMAZING BALL" = 12 chars, size 4 -> largeur approximative = 10*4*12 = 480px
-        int titleWidth = 10 * titleSize * 12;
-        int titleX = (800 - titleWidth) / 2;
-        int titleY = 70;
-
         // Effet de halo coloré arc-en-ciel autour du titre
-        int titleHeight = 7 * titleSize;  // Hauteur réelle du texte (7 pixels de hauteur par caractère)
+        int titleHeight = 7 * TITLE_SIZE;  // Hauteur réelle du texte (7 pixels de hauteur par caractère)
         for (int i = 0; i < 5; i++) {
             float haloPhase = titlePulse * 0.5f + i * 0.3f;
-            int r = static_cast<int>(128 + 127 * std::sin(haloPhase));
-            int g = static_cast<int>(128 + 127 * std::sin(haloPhase + 2.0f));
-            int b = static_cast<int>(128 + 127 * std::sin(haloPhase + 4.0f));
+            uint32_t haloPhaseTurn = FastMath::radiansToPhase(haloPhase);
+            int r = static_cast<int>(128 + 127 * FastMath::sinPhase(haloPhaseTurn));
+            int g = static_cast<int>(128 + 127 * FastMath::sinPhase(haloPhaseTurn + RAINBOW_GREEN_SHIFT));
+            int b = static_cast<int>(128 + 127 * FastMath::sinPhase(haloPhaseTurn + RAINBOW_BLUE_SHIFT));
             int alpha = 40 - i * 8;
 
             SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
             SDL_SetRenderDrawColor(renderer, r, g, b, alpha);
             int offset = (5 - i) * 4;
-            SDL_Rect haloRect = {titleX - offset, titleY - offset, titleWidth + offset * 2, titleHeight + offset * 2};
+            SDL_Rect haloRect = {TITLE_X - offset, TITLE_Y - offset, TITLE_WIDTH + offset * 2, titleHeight + offset * 2};
             SDL_RenderFillRect(renderer, &haloRect);
         }
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
-        // Ombre portée du titre (décalée légèrement en bas à droite)
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        drawText(renderer, "AMAZING BALL", titleX + 3, titleY + 3, titleSize, false);
-
-        // Titre principal avec dégradé arc-en-ciel animé
-        std::string title = "AMAZING BALL";
-        for (size_t i = 0; i < title.length(); i++) {
-            // Calculer la couleur pour chaque lettre (effet arc-en-ciel qui défile)
-            float colorPhase = titlePulse * 2.0f + i * 0.5f;
-            int r = static_cast<int>(128 + 127 * std::sin(colorPhase));
-            int g = static_cast<int>(128 + 127 * std::sin(colorPhase + 2.0f));
-            int b = static_cast<int>(128 + 127 * std::sin(colorPhase + 4.0f));
-
-            SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-
-            // Dessiner chaque lettre individuellement
-            std::string letter(1, title[i]);
-            int letterX = titleX + i * 10 * titleSize;
-            drawText(renderer, letter, letterX, titleY, titleSize, false);
+        // Titre, options et instructions
+        if (mainLayer.beginRedraw(renderer, selectedOption, 0, 0, LAYER_WIDTH, LAYER_HEIGHT)) {
+            renderMainLayer(renderer);
+            mainLayer.endRedraw(renderer);
         }
+        mainLayer.draw(renderer);
 
         // Effet de brillance qui traverse le titre périodiquement
         float shinePos = std::fmod(titlePulse * 0.3f, 2.0f);
         if (shinePos < 1.0f) {
-            int shineX = static_cast<int>(titleX + shinePos * titleWidth);
+            int shineX = static_cast<int>(TITLE_X + shinePos * TITLE_WIDTH);
             SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
             SDL_SetRenderDrawColor(renderer, 255, 255, 255, 100);
             for (int i = -10; i <= 10; i++) {
                 int alpha = 100 - std::abs(i) * 10;
                 SDL_SetRenderDrawColor(renderer, 255, 255, 255, alpha);
-                SDL_RenderDrawLine(renderer, shineX + i * 2, titleY - 10, shineX + i * 2, titleY + 100);
+                SDL_RenderDrawLine(renderer, shineX + i * 2, TITLE_Y - 10, shineX + i * 2, TITLE_Y + 100);
             }
             SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
         }
 
-        // Options du menu (toutes centrées)
-        int menuY = 250;
-        int menuSpacing = 70;
-
-        // "JOUER" = 5 chars, size 2 -> largeur = 10*2*5 = 100px -> x_centre = (800-100)/2 = 350
-        drawText(renderer, "JOUER", 350, menuY, 2, selectedOption == 0);
-        // "CREDITS" = 7 chars, size 2 -> largeur = 10*2*7 = 140px -> x_centre = (800-140)/2 = 330
-        drawText(renderer, "CREDITS", 330, menuY + menuSpacing, 2, selectedOption == 1);
-        // "QUITTER" = 7 chars, size 2 -> largeur = 10*2*7 = 140px -> x_centre = (800-140)/2 = 330
-        drawText(renderer, "QUITTER", 330, menuY + menuSpacing * 2, 2, selectedOption == 2);
-
-        // Instructions en bas
-        SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
-        // "FLECHES HAUT BAS   ENTREE POUR VALIDER" = 39 chars, size 1 -> largeur = 10*1*39 = 390px -> x_centre = (800-390)/2 = 205
-        drawText(renderer, "FLECHES HAUT BAS   ENTREE POUR VALIDER", 205, 530, 1, false);
-
-        // Indication pour accéder aux meilleurs scores
-        SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255); // Couleur dorée
-        // "FLECHE DROITE POUR MEILLEURS SCORES" = 36 chars, size 1 -> largeur = 10*1*36 = 360px -> x_centre = (800-360)/2 = 220
-        drawText(renderer, "FLECHE DROITE POUR MEILLEURS SCORES", 220, 550, 1, false);
-
     } else if (state == MenuState::DIFFICULTY_SELECTION) {
-        // Écran de sélection de difficulté
-        // "CHOISIR DIFFICULTE" = 18 chars, size 3 -> largeur = 10*3*18 = 540px -> x_centre = (800-540)/2 = 130
-        drawText(renderer, "CHOISIR DIFFICULTE", 130, 100, 3, false);
-
-        int menuY = 250;
-        int menuSpacing = 80;
-
-        // Options de difficulté (toutes centrées)
-        // "FACILE" = 6 chars, size 2 -> largeur = 10*2*6 = 120px -> x_centre = (800-120)/2 = 340
-        drawText(renderer, "FACILE", 340, menuY, 2, selectedOption == 0);
-        // "MOYEN" = 5 chars, size 2 -> largeur = 10*2*5 = 100px -> x_centre = (800-100)/2 = 350
-        drawText(renderer, "MOYEN", 350, menuY + menuSpacing, 2, selectedOption == 1);
-        // "DIFFICILE" = 9 chars, size 2 -> largeur = 10*2*9 = 180px -> x_centre = (800-180)/2 = 310
-        drawText(renderer, "DIFFICILE", 310, menuY + menuSpacing * 2, 2, selectedOption == 2);
-
-        // Instructions en bas
-        SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
-        // "FLECHES   ENTREE   ECHAP POUR RETOUR" = 37 chars, size 1 -> largeur = 10*1*37 = 370px -> x_centre = (800-370)/2 = 215
-        drawText(renderer, "FLECHES   ENTREE   ECHAP POUR RETOUR", 215, 550, 1, false);
+        if (difficultyLayer.beginRedraw(renderer, selectedOption, 0, 0, LAYER_WIDTH, LAYER_HEIGHT)) {
+            renderDifficultyLayer(renderer);
+            difficultyLayer.endRedraw(renderer);
+        }
+        difficultyLayer.draw(renderer);
 
     } else if (state == MenuState::CREDITS_SCREEN) {
-        // Écran des crédits
-        // Calculer les positions centrées (écran 800px de large)
-        // Format: (charWidth + spacing) * nb_chars = (8*size + 2*size) * nb_chars = 10*size * nb_chars
-
-        // "CREDITS" = 7 chars, size 3 -> largeur = 10*3*7 = 210px -> x_centre = (800-210)/2 = 295
-        drawText(renderer, "CREDITS", 295, 50, 3, false);
-
-        int y = 150;
-        int spacing = 50;
-
-        SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
-        // "DEVELOPPEMENT" = 13 chars, size 2 -> largeur = 10*2*13 = 260px -> x_centre = (800-260)/2 = 270
-        drawText(renderer, "DEVELOPPEMENT", 270, y, 2, false);
-        y += spacing;
-        // "BRUNO BOIRIE" = 12 chars, size 1 -> largeur = 10*1*12 = 120px -> x_centre = (800-120)/2 = 340
-        drawText(renderer, "BRUNO BOIRIE", 340, y, 1, false);
-        y += spacing * 2;
-
-        // "GRAPHISMES" = 10 chars, size 2 -> largeur = 10*2*10 = 200px -> x_centre = (800-200)/2 = 300
-        drawText(renderer, "GRAPHISMES", 300, y, 2, false);
-        y += spacing;
-        drawText(renderer, "BRUNO BOIRIE", 340, y, 1, false);
-        y += spacing * 2;
-
-        // "MOTEUR" = 6 chars, size 2 -> largeur = 10*2*6 = 120px -> x_centre = (800-120)/2 = 340
-        drawText(renderer, "MOTEUR", 340, y, 2, false);
-        y += spacing;
-        // "SDL2" = 4 chars, size 1 -> largeur = 10*1*4 = 40px -> x_centre = (800-40)/2 = 380
-        drawText(renderer, "SDL2", 380, y, 1, false);
-
-        // Instruction de retour
-        SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
-        // "APPUYER SUR ECHAP POUR REVENIR" = 30 chars, size 1 -> largeur = 10*1*30 = 300px -> x_centre = (800-300)/2 = 250
-        drawText(renderer, "APPUYER SUR ECHAP POUR REVENIR", 250, 550, 1, false);
+        if (creditsLayer.beginRedraw(renderer, 0, 0, 0, LAYER_WIDTH, LAYER_HEIGHT)) {
+            renderCreditsLayer(renderer);
+            creditsLayer.endRedraw(renderer);
+        }
+        creditsLayer.draw(renderer);
+
     } else if (state == MenuState::HIGHSCORES_SCREEN) {
-        renderHighScoresScreen(renderer);
+        if (highScoresLayer.beginRedraw(renderer, highScoresRevision, 0, 0, LAYER_WIDTH, LAYER_HEIGHT)) {
+            renderHighScoresScreen(renderer);
+            highScoresLayer.endRedraw(renderer);
+        }
+        highScoresLayer.draw(renderer);
     }
 }
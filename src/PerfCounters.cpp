@@ -0,0 +1,176 @@
+#include "PerfCounters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace {
+
+const int COUNTER_COUNT = static_cast<int>(PerfCounter::COUNT);
+
+#ifdef __linux__
+long perfEventOpen(perf_event_attr* attr, pid_t pid, int cpu, int groupFd, unsigned long flags) {
+    return syscall(__NR_perf_event_open, attr, pid, cpu, groupFd, flags);
+}
+
+void describeCounter(PerfCounter counter, __u32& type, __u64& config) {
+    switch (counter) {
+        case PerfCounter::INSTRUCTIONS:
+            type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_INSTRUCTIONS; break;
+        case PerfCounter::CYCLES:
+            type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_CPU_CYCLES; break;
+        case PerfCounter::CACHE_MISSES:
+            type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_CACHE_MISSES; break;
+        case PerfCounter::BRANCH_MISSES:
+            type = PERF_TYPE_HARDWARE; config = PERF_COUNT_HW_BRANCH_MISSES; break;
+        case PerfCounter::TASK_CLOCK:
+            type = PERF_TYPE_SOFTWARE; config = PERF_COUNT_SW_TASK_CLOCK; break;
+        case PerfCounter::PAGE_FAULTS:
+        default:
+            type = PERF_TYPE_SOFTWARE; config = PERF_COUNT_SW_PAGE_FAULTS; break;
+    }
+}
+#endif
+
+} // namespace
+
+PerfCounters::PerfCounters()
+    : hardwareCount(0),
+      softwareCount(0),
+      hardwareGroupFd(-1),
+      softwareGroupFd(-1) {
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        fds[i] = -1;
+    }
+}
+
+PerfCounters::~PerfCounters() {
+    close();
+}
+
+bool PerfCounters::open() {
+    close();
+
+    // Compteurs matériels en un seul groupe : une seule lecture par échantillon
+    // et des valeurs mesurées sur la même fenêtre d'exécution
+    const PerfCounter hardware[] = {
+        PerfCounter::CYCLES,  // Meneur du groupe
+        PerfCounter::INSTRUCTIONS,
+        PerfCounter::CACHE_MISSES,
+        PerfCounter::BRANCH_MISSES
+    };
+    openGroup(hardware, 4, hardwareGroupFd, hardwareOrder, hardwareCount);
+
+    // Repli sur les compteurs logiciels si le PMU est inaccessible
+    if (hardwareGroupFd < 0) {
+        const PerfCounter software[] = {
+            PerfCounter::TASK_CLOCK,
+            PerfCounter::PAGE_FAULTS
+        };
+        openGroup(software, 2, softwareGroupFd, softwareOrder, softwareCount);
+    }
+
+    return hardwareGroupFd >= 0 || softwareGroupFd >= 0;
+}
+
+void PerfCounters::openGroup(const PerfCounter* counters, int count,
+                             int& groupFd, PerfCounter* order, int& orderCount) {
+    groupFd = -1;
+    orderCount = 0;
+
+#ifdef __linux__
+    for (int i = 0; i < count; i++) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        describeCounter(counters[i], attr.type, attr.config);
+        attr.read_format = PERF_FORMAT_GROUP;
+        attr.disabled = (groupFd < 0) ? 1 : 0;  // Seul le meneur démarre désactivé
+        attr.exclude_kernel = 1;                // Requis avec perf_event_paranoid >= 2
+        attr.exclude_hv = 1;
+
+        int fd = static_cast<int>(perfEventOpen(&attr, 0, -1, groupFd, 0));
+        if (fd < 0) {
+            // Sans meneur, le groupe entier est indisponible
+            if (groupFd < 0) {
+                return;
+            }
+            continue;
+        }
+
+        if (groupFd < 0) {
+            groupFd = fd;
+        }
+        fds[static_cast<int>(counters[i])] = fd;
+        order[orderCount++] = counters[i];
+    }
+
+    if (groupFd >= 0) {
+        ioctl(groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#else
+    (void)counters;
+    (void)count;
+    (void)order;
+#endif
+}
+
+void PerfCounters::close() {
+#ifdef __linux__
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (fds[i] >= 0) {
+            ::close(fds[i]);
+        }
+    }
+#endif
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        fds[i] = -1;
+    }
+    hardwareGroupFd = -1;
+    softwareGroupFd = -1;
+    hardwareCount = 0;
+    softwareCount = 0;
+}
+
+bool PerfCounters::isAvailable(PerfCounter counter) const {
+    return fds[static_cast<int>(counter)] >= 0;
+}
+
+void PerfCounters::read(PerfSample& sample) const {
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        sample.values[i] = 0;
+    }
+    readGroup(hardwareGroupFd, hardwareOrder, hardwareCount, sample);
+    readGroup(softwareGroupFd, softwareOrder, softwareCount, sample);
+}
+
+void PerfCounters::readGroup(int groupFd, const PerfCounter* order, int orderCount,
+                             PerfSample& sample) const {
+#ifdef __linux__
+    if (groupFd < 0) {
+        return;
+    }
+
+    // Format PERF_FORMAT_GROUP : { nr, values[nr] }
+    uint64_t buffer[1 + COUNTER_COUNT];
+    ssize_t bytes = ::read(groupFd, buffer, sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(sizeof(uint64_t))) {
+        return;
+    }
+
+    int nr = static_cast<int>(buffer[0]);
+    for (int i = 0; i < nr && i < orderCount; i++) {
+        sample.values[static_cast<int>(order[i])] = buffer[1 + i];
+    }
+#else
+    (void)groupFd;
+    (void)order;
+    (void)orderCount;
+    (void)sample;
+#endif
+}
@@ -1,52 +1,65 @@
 #include "Player.hpp"
-#include "AudioManager.hpp"
+#include "InputState.hpp"
+#include "Snapshot.hpp"
+#include "SimMath.hpp"
+#include "Collision.hpp"
 #include <cmath>
 
 Player::Player(float x, float y)
-    : position(x, y),
-      velocity(0, 0),
-      direction(Direction::DOWN),
-      speed(3.5f),
+    : speed(3.5f),
       radius(8),  // Réduit de 30% supplémentaires (12 -> 8.4, arrondi à 8)
-      isJumping(false),
-      isGrounded(true),
       jumpVelocity(-7.5f),   // Vitesse initiale du saut (ajustée)
       gravity(0.6f),          // Force de gravité
-      verticalVelocity(0.0f),
-      groundLevel(y),
-      haloPhase(0.0f),
       haloSpeed(0.08f),
       satelliteOffsetX(25.0f),  // À droite du joueur
       satelliteOffsetY(-20.0f), // Au-dessus du joueur
-      satelliteFloatPhase(0.0f),
       satelliteFloatSpeed(0.05f),
-      satelliteRadius(6),
-      satelliteLagX(0.0f),
-      satelliteLagY(0.0f),
-      previousPosition(x, y),
-      shadowGroundY(y + 13),  // Position initiale de l'ombre au sol
-      knockbackVelocity(0, 0),
-      knockbackFrames(0),
-      attacking(false),
-      attackTimer(0),
-      isInvincible(false) {
+      satelliteRadius(6) {
+    reset(x, y);
+}
+
+Player::~Player() {}
+
+void Player::reset(float x, float y) {
+    position = Vector2D(x, y);
+    velocity.zero();
+    direction = Direction::DOWN;
+
+    isJumping = false;
+    isGrounded = true;
+    verticalVelocity = 0.0f;
+    groundLevel = y;
+
+    haloPhase = 0.0f;
+    satelliteFloatPhase = 0.0f;
+    satelliteLagX = 0.0f;
+    satelliteLagY = 0.0f;
+    previousPosition = Vector2D(x, y);
+
     // Initialiser l'historique de positions avec la position de départ
     for (int i = 0; i < SATELLITE_DELAY_FRAMES; i++) {
-        positionHistory.push_back(Vector2D(x, y));
+        positionHistory[i] = Vector2D(x, y);
     }
-}
+    historyHead = 0;
 
-Player::~Player() {}
+    shadowGroundY = y + 13;  // Position initiale de l'ombre au sol
 
-void Player::handleInput() {
-    const Uint8* keyState = SDL_GetKeyboardState(nullptr);
+    knockbackVelocity.zero();
+    knockbackFrames = 0;
+
+    attacking = false;
+    attackTimer = 0;
+
+    isInvincible = false;
+}
 
+void Player::handleInput(uint8_t heldKeys) {
     velocity.zero();
 
-    bool up = keyState[SDL_SCANCODE_UP];
-    bool down = keyState[SDL_SCANCODE_DOWN];
-    bool left = keyState[SDL_SCANCODE_LEFT];
-    bool right = keyState[SDL_SCANCODE_RIGHT];
+    bool up = (heldKeys & InputKeys::UP) != 0;
+    bool down = (heldKeys & InputKeys::DOWN) != 0;
+    bool left = (heldKeys & InputKeys::LEFT) != 0;
+    bool right = (heldKeys & InputKeys::RIGHT) != 0;
 
     // Déplacement avec les flèches
     if (up) {
@@ -90,26 +103,26 @@ void Player::handleInput() {
     }
 }
 
-void Player::handleEvent(SDL_Event& event) {
-    if (event.type == SDL_KEYDOWN) {
-        // Saut avec W ou Espace
-        if ((event.key.keysym.sym == SDLK_w || event.key.keysym.sym == SDLK_SPACE) && isGrounded && !attacking) {
-            isJumping = true;
-            isGrounded = false;
-            verticalVelocity = jumpVelocity;
-            // groundLevel est déjà à jour car on le met à jour continuellement dans update()
-            // Jouer le son de saut
-            AudioManager::getInstance().playSound(SoundEffect::JUMP);
-        }
+bool Player::jump() {
+    if (!isGrounded || attacking) {
+        return false;
+    }
 
-        // Attaque avec Shift
-        if (event.key.keysym.sym == SDLK_LSHIFT && !attacking) {
-            attacking = true;
-            attackTimer = attackDuration;
-            // Jouer le son d'attaque
-            AudioManager::getInstance().playSound(SoundEffect::ATTACK);
-        }
+    isJumping = true;
+    isGrounded = false;
+    verticalVelocity = jumpVelocity;
+    // groundLevel est déjà à jour car on le met à jour continuellement dans update()
+    return true;
+}
+
+bool Player::attack() {
+    if (attacking) {
+        return false;
     }
+
+    attacking = true;
+    attackTimer = attackDuration;
+    return true;
 }
 
 void Player::update() {
@@ -118,8 +131,8 @@ void Player::update() {
         position += knockbackVelocity;
 
         // Réduire progressivement la vélocité du recul
-        knockbackVelocity.x *= 0.85f;
-        knockbackVelocity.y *= 0.85f;
+        knockbackVelocity.x = simFloat(SimReal(knockbackVelocity.x) * SimReal(0.85f));
+        knockbackVelocity.y = simFloat(SimReal(knockbackVelocity.y) * SimReal(0.85f));
 
         knockbackFrames--;
 
@@ -150,8 +163,9 @@ void Player::update() {
         shadowGroundY = groundLevel + 13;
 
         // Appliquer la gravité (physique du saut)
-        verticalVelocity += gravity;
-        position.y += verticalVelocity;
+        SimReal vertical = SimReal(verticalVelocity) + SimReal(gravity);
+        verticalVelocity = simFloat(vertical);
+        position.y = simFloat(SimReal(position.y) + vertical);
 
         // Vérifier si on touche le sol
         if (position.y >= groundLevel) {
@@ -180,15 +194,12 @@ void Player::update() {
         verticalVelocity = 0.0f;
     }
 
-    // Mettre à jour l'historique des positions
-    positionHistory.push_back(position);
-    if (positionHistory.size() > SATELLITE_DELAY_FRAMES) {
-        positionHistory.pop_front();
-    }
+    // Mettre à jour l'historique des positions (remplace la plus ancienne)
+    positionHistory[historyHead] = position;
+    historyHead = (historyHead + 1) % SATELLITE_DELAY_FRAMES;
 
     // Utiliser la position d'il y a 15 frames pour le satellite
-    // Sécurité: utiliser la position actuelle si l'historique n'est pas encore complet
-    Vector2D delayedPosition = positionHistory.empty() ? position : positionHistory.front();
+    Vector2D delayedPosition = positionHistory[historyHead];
 
     // Calculer le déplacement basé sur la position retardée
     Vector2D movement = delayedPosition - previousPosition;
@@ -242,250 +253,21 @@ void Player::update() {
     }
 }
 
-void Player::drawCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) {
-    // Algorithme de Bresenham pour dessiner un cercle
-    int x = radius;
-    int y = 0;
-    int err = 0;
-
-    while (x >= y) {
-        SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-        SDL_RenderDrawPoint(renderer, centerX + y, centerY + x);
-        SDL_RenderDrawPoint(renderer, centerX - y, centerY + x);
-        SDL_RenderDrawPoint(renderer, centerX - x, centerY + y);
-        SDL_RenderDrawPoint(renderer, centerX - x, centerY - y);
-        SDL_RenderDrawPoint(renderer, centerX - y, centerY - x);
-        SDL_RenderDrawPoint(renderer, centerX + y, centerY - x);
-        SDL_RenderDrawPoint(renderer, centerX + x, centerY - y);
-
-        if (err <= 0) {
-            y += 1;
-            err += 2 * y + 1;
-        }
-        if (err > 0) {
-            x -= 1;
-            err -= 2 * x + 1;
-        }
-    }
-}
-
-void Player::drawFilledCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) {
-    // Dessiner un cercle rempli
-    for (int y = -radius; y <= radius; y++) {
-        for (int x = -radius; x <= radius; x++) {
-            if (x * x + y * y <= radius * radius) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-}
-
-void Player::drawGradientCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius,
-                                int r, int g, int b, int maxAlpha) {
-    // Dessiner un cercle avec dégradé de transparence
-    // La transparence diminue du centre vers les bords
-    for (int y = -radius; y <= radius; y++) {
-        for (int x = -radius; x <= radius; x++) {
-            int distSquared = x * x + y * y;
-            int radiusSquared = radius * radius;
-
-            if (distSquared <= radiusSquared) {
-                // Calculer la distance normalisée (0 au centre, 1 au bord)
-                float dist = std::sqrt(static_cast<float>(distSquared)) / radius;
-
-                // Inverser pour avoir maxAlpha au centre et 0 au bord
-                // Utiliser une courbe douce pour la transition
-                float alpha = maxAlpha * (1.0f - dist * dist);
-
-                SDL_SetRenderDrawColor(renderer, r, g, b, static_cast<Uint8>(alpha));
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-}
-
-void Player::render(SDL_Renderer* renderer) {
-    int centerX = static_cast<int>(position.x);
-    int centerY = static_cast<int>(position.y);
-
-    // Facteur de transparence pour l'invincibilité (40% si invincible)
-    float alphaFactor = isInvincible ? 0.4f : 1.0f;
-
-    // ===== SATELLITE =====
-    // Utiliser la position retardée pour le satellite
-    // Sécurité: utiliser la position actuelle si l'historique n'est pas encore complet
-    Vector2D delayedPosition = positionHistory.empty() ? position : positionHistory.front();
-
-    // Calculer la position du satellite avec effet de flottement et inertie
-    float floatOffset = 4.0f * std::sin(satelliteFloatPhase);
-    int satX = static_cast<int>(delayedPosition.x + satelliteOffsetX + satelliteLagX);
-    int satY = static_cast<int>(delayedPosition.y + satelliteOffsetY + floatOffset + satelliteLagY);
-
-    // Ombre du satellite pour donner l'impression de profondeur
-    int shadowY = static_cast<int>(delayedPosition.y + satelliteOffsetY + satelliteLagY + 15);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, static_cast<Uint8>(30 * alphaFactor));
-    drawFilledCircle(renderer, satX, shadowY, satelliteRadius - 1);
-
-    // Halo orange du satellite (plus petit)
-    drawGradientCircle(renderer, satX, satY, satelliteRadius * 2, 255, 140, 0, static_cast<int>(40 * alphaFactor));
-
-    // Corps du satellite - orange foncé
-    SDL_SetRenderDrawColor(renderer, 200, 80, 0, static_cast<Uint8>(255 * alphaFactor));
-    drawFilledCircle(renderer, satX, satY, satelliteRadius);
-
-    // Centre lumineux orange
-    SDL_SetRenderDrawColor(renderer, 255, 140, 0, static_cast<Uint8>(255 * alphaFactor));
-    drawFilledCircle(renderer, satX, satY, satelliteRadius / 2);
-
-    // Petite brillance blanche
-    SDL_SetRenderDrawColor(renderer, 255, 200, 100, static_cast<Uint8>(255 * alphaFactor));
-    drawFilledCircle(renderer, satX - 1, satY - 1, satelliteRadius / 3);
-
-    // ===== JOUEUR =====
-    // Ombre du joueur - dessinée en premier pour être derrière le halo
-    // L'ombre utilise shadowGroundY qui reste fixe pendant le saut
-    int playerShadowY = static_cast<int>(shadowGroundY);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, static_cast<Uint8>(60 * alphaFactor));
-    drawFilledCircle(renderer, centerX, playerShadowY, radius + 2);
-
-    // Calculer la pulsation du halo (oscille entre 0.9 et 1.1)
-    float haloPulse = 1.0f + 0.1f * std::sin(haloPhase);
-
-    // Dessiner les halos avec dégradé (du plus grand au plus petit)
-    // Halo externe 1 - très subtil, s'estompe complètement aux bords
-    int haloRadius1 = static_cast<int>(radius * 3.0f * haloPulse);
-    drawGradientCircle(renderer, centerX, centerY, haloRadius1, 255, 255, 255, static_cast<int>(30 * alphaFactor));
-
-    // Halo externe 2 - dégradé doux
-    int haloRadius2 = static_cast<int>(radius * 2.2f * haloPulse);
-    drawGradientCircle(renderer, centerX, centerY, haloRadius2, 255, 255, 255, static_cast<int>(50 * alphaFactor));
-
-    // Halo interne - plus intense
-    int haloRadius3 = static_cast<int>(radius * 1.5f);
-    drawGradientCircle(renderer, centerX, centerY, haloRadius3, 255, 255, 255, static_cast<int>(100 * alphaFactor));
-
-    // Bord lumineux de la boule
-    int glowRadius = static_cast<int>(radius * 1.2f);
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(180 * alphaFactor));
-    drawFilledCircle(renderer, centerX, centerY, glowRadius);
-
-    // Coeur blanc brillant de la boule
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(255 * alphaFactor));
-    drawFilledCircle(renderer, centerX, centerY, radius);
-
-    // Centre ultra-lumineux (petit cercle au centre)
-    int coreRadius = static_cast<int>(radius * 0.5f);
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(255 * alphaFactor));
-    drawFilledCircle(renderer, centerX, centerY, coreRadius);
-
-    // Si le joueur attaque, dessiner un éclair d'énergie
-    if (attacking) {
-        float attackIntensity = static_cast<float>(attackTimer) / attackDuration;
-
-        // Éclair d'énergie qui suit la direction
-        int energyLength = 30;
-        int energyWidth = 6;
-
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(200 * attackIntensity * alphaFactor));
-
-        switch (direction) {
-            case Direction::UP:
-                for (int i = 0; i < energyLength; i++) {
-                    int y = centerY - radius - i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int dx = -thickness; dx <= thickness; dx++) {
-                        SDL_RenderDrawPoint(renderer, centerX + dx, y);
-                    }
-                }
-                break;
-            case Direction::DOWN:
-                for (int i = 0; i < energyLength; i++) {
-                    int y = centerY + radius + i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int dx = -thickness; dx <= thickness; dx++) {
-                        SDL_RenderDrawPoint(renderer, centerX + dx, y);
-                    }
-                }
-                break;
-            case Direction::LEFT:
-                for (int i = 0; i < energyLength; i++) {
-                    int x = centerX - radius - i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int dy = -thickness; dy <= thickness; dy++) {
-                        SDL_RenderDrawPoint(renderer, x, centerY + dy);
-                    }
-                }
-                break;
-            case Direction::RIGHT:
-                for (int i = 0; i < energyLength; i++) {
-                    int x = centerX + radius + i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int dy = -thickness; dy <= thickness; dy++) {
-                        SDL_RenderDrawPoint(renderer, x, centerY + dy);
-                    }
-                }
-                break;
-            case Direction::UP_LEFT:
-                for (int i = 0; i < energyLength; i++) {
-                    int x = centerX - radius - i;
-                    int y = centerY - radius - i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int t = -thickness; t <= thickness; t++) {
-                        SDL_RenderDrawPoint(renderer, x + t, y - t);
-                        SDL_RenderDrawPoint(renderer, x - t, y + t);
-                    }
-                }
-                break;
-            case Direction::UP_RIGHT:
-                for (int i = 0; i < energyLength; i++) {
-                    int x = centerX + radius + i;
-                    int y = centerY - radius - i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int t = -thickness; t <= thickness; t++) {
-                        SDL_RenderDrawPoint(renderer, x - t, y - t);
-                        SDL_RenderDrawPoint(renderer, x + t, y + t);
-                    }
-                }
-                break;
-            case Direction::DOWN_LEFT:
-                for (int i = 0; i < energyLength; i++) {
-                    int x = centerX - radius - i;
-                    int y = centerY + radius + i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int t = -thickness; t <= thickness; t++) {
-                        SDL_RenderDrawPoint(renderer, x - t, y - t);
-                        SDL_RenderDrawPoint(renderer, x + t, y + t);
-                    }
-                }
-                break;
-            case Direction::DOWN_RIGHT:
-                for (int i = 0; i < energyLength; i++) {
-                    int x = centerX + radius + i;
-                    int y = centerY + radius + i;
-                    int thickness = energyWidth - (i * energyWidth / energyLength);
-                    for (int t = -thickness; t <= thickness; t++) {
-                        SDL_RenderDrawPoint(renderer, x + t, y - t);
-                        SDL_RenderDrawPoint(renderer, x - t, y + t);
-                    }
-                }
-                break;
-        }
-    }
-}
-
 void Player::applyKnockback(const Vector2D& sourcePos) {
     // Calculer la direction du recul (opposée à la source)
     Vector2D knockbackDir = position - sourcePos;
-    float length = std::sqrt(knockbackDir.x * knockbackDir.x + knockbackDir.y * knockbackDir.y);
+    SimReal dirX = knockbackDir.x;
+    SimReal dirY = knockbackDir.y;
+    SimReal length = simHypot(dirX, dirY);
 
-    if (length > 0) {
-        knockbackDir.x /= length;
-        knockbackDir.y /= length;
+    if (length > SimReal(0)) {
+        dirX = dirX / length;
+        dirY = dirY / length;
     }
 
     // Appliquer un recul (distance de 3 fois le rayon du joueur)
-    float knockbackDistance = radius * 3.0f;
-    knockbackVelocity = knockbackDir * (knockbackDistance / knockbackDuration);
+    SimReal knockbackSpeed = SimReal(radius * 3) / SimReal(knockbackDuration);
+    knockbackVelocity = Vector2D(simFloat(dirX * knockbackSpeed), simFloat(dirY * knockbackSpeed));
     knockbackFrames = knockbackDuration;
 }
 
@@ -496,7 +278,7 @@ void Player::blockMovementTowards(const Vector2D& obstaclePos, int obstacleRadiu
     // Calculer la distance actuelle entre le joueur et l'obstacle
     float dx = position.x - obstaclePos.x;
     float dy = position.y - obstaclePos.y;
-    float currentDistance = std::sqrt(dx * dx + dy * dy);
+    float currentDistance = simLength(dx, dy);
 
     // Si on est trop proche, repousser fermement le joueur (mur solide)
     if (currentDistance < minDistance) {
@@ -524,3 +306,66 @@ void Player::blockMovementTowards(const Vector2D& obstaclePos, int obstacleRadiu
         }
     }
 }
+
+void Player::blockSweptMovement(const Vector2D& from, const Vector2D& obstaclePos, int obstacleRadius) {
+    // Un grand pas (recul) a pu traverser l'obstacle : s'arrêter au contact
+    float t;
+    if (Collision::sweepCircle(from, position, obstaclePos, static_cast<float>(radius + obstacleRadius), t)) {
+        position = Collision::pointAt(from, position, t);
+    }
+
+    blockMovementTowards(obstaclePos, obstacleRadius);
+}
+
+void Player::saveState(PlayerSnapshot& snapshot) const {
+    static_assert(SATELLITE_DELAY_FRAMES == SnapshotLimits::PLAYER_HISTORY,
+                  "Taille de l'historique différente de celle de l'instantané");
+
+    snapshot.position = position;
+    snapshot.velocity = velocity;
+    snapshot.previousPosition = previousPosition;
+    snapshot.knockbackVelocity = knockbackVelocity;
+    for (int i = 0; i < SATELLITE_DELAY_FRAMES; i++) {
+        snapshot.positionHistory[i] = positionHistory[i];
+    }
+    snapshot.direction = static_cast<int32_t>(direction);
+    snapshot.historyHead = historyHead;
+    snapshot.knockbackFrames = knockbackFrames;
+    snapshot.attackTimer = attackTimer;
+    snapshot.verticalVelocity = verticalVelocity;
+    snapshot.groundLevel = groundLevel;
+    snapshot.haloPhase = haloPhase;
+    snapshot.satelliteFloatPhase = satelliteFloatPhase;
+    snapshot.satelliteLagX = satelliteLagX;
+    snapshot.satelliteLagY = satelliteLagY;
+    snapshot.shadowGroundY = shadowGroundY;
+    snapshot.isJumping = isJumping;
+    snapshot.isGrounded = isGrounded;
+    snapshot.attacking = attacking;
+    snapshot.isInvincible = isInvincible;
+}
+
+void Player::loadState(const PlayerSnapshot& snapshot) {
+    position = snapshot.position;
+    velocity = snapshot.velocity;
+    previousPosition = snapshot.previousPosition;
+    knockbackVelocity = snapshot.knockbackVelocity;
+    for (int i = 0; i < SATELLITE_DELAY_FRAMES; i++) {
+        positionHistory[i] = snapshot.positionHistory[i];
+    }
+    direction = static_cast<Direction>(snapshot.direction);
+    historyHead = snapshot.historyHead;
+    knockbackFrames = snapshot.knockbackFrames;
+    attackTimer = snapshot.attackTimer;
+    verticalVelocity = snapshot.verticalVelocity;
+    groundLevel = snapshot.groundLevel;
+    haloPhase = snapshot.haloPhase;
+    satelliteFloatPhase = snapshot.satelliteFloatPhase;
+    satelliteLagX = snapshot.satelliteLagX;
+    satelliteLagY = snapshot.satelliteLagY;
+    shadowGroundY = snapshot.shadowGroundY;
+    isJumping = snapshot.isJumping != 0;
+    isGrounded = snapshot.isGrounded != 0;
+    attacking = snapshot.attacking != 0;
+    isInvincible = snapshot.isInvincible != 0;
+}
@@ -0,0 +1,234 @@
+#include "Player.hpp"
+#include "FastMath.hpp"
+#include <SDL2/SDL.h>
+#include <cmath>
+
+void Player::drawCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) {
+    // Algorithme de Bresenham pour dessiner un cercle
+    int x = radius;
+    int y = 0;
+    int err = 0;
+
+    while (x >= y) {
+        SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
+        SDL_RenderDrawPoint(renderer, centerX + y, centerY + x);
+        SDL_RenderDrawPoint(renderer, centerX - y, centerY + x);
+        SDL_RenderDrawPoint(renderer, centerX - x, centerY + y);
+        SDL_RenderDrawPoint(renderer, centerX - x, centerY - y);
+        SDL_RenderDrawPoint(renderer, centerX - y, centerY - x);
+        SDL_RenderDrawPoint(renderer, centerX + y, centerY - x);
+        SDL_RenderDrawPoint(renderer, centerX + x, centerY - y);
+
+        if (err <= 0) {
+            y += 1;
+            err += 2 * y + 1;
+        }
+        if (err > 0) {
+            x -= 1;
+            err -= 2 * x + 1;
+        }
+    }
+}
+
+void Player::drawFilledCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) {
+    // Dessiner un cercle rempli
+    for (int y = -radius; y <= radius; y++) {
+        for (int x = -radius; x <= radius; x++) {
+            if (x * x + y * y <= radius * radius) {
+                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
+            }
+        }
+    }
+}
+
+void Player::drawGradientCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius,
+                                int r, int g, int b, int maxAlpha) {
+    // Dessiner un cercle avec dégradé de transparence
+    // La transparence diminue du centre vers les bords
+    for (int y = -radius; y <= radius; y++) {
+        for (int x = -radius; x <= radius; x++) {
+            int distSquared = x * x + y * y;
+            int radiusSquared = radius * radius;
+
+            if (distSquared <= radiusSquared) {
+                // Carré de la distance normalisée (0 au centre, 1 au bord) :
+                // la courbe n'utilise que ce carré, la racine est inutile
+
+                // Inverser pour avoir maxAlpha au centre et 0 au bord
+                // Utiliser une courbe douce pour la transition
+                float alpha = maxAlpha * (1.0f - static_cast<float>(distSquared) / radiusSquared);
+
+                SDL_SetRenderDrawColor(renderer, r, g, b, static_cast<Uint8>(alpha));
+                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
+            }
+        }
+    }
+}
+
+void Player::render(SDL_Renderer* renderer) {
+    int centerX = static_cast<int>(position.x);
+    int centerY = static_cast<int>(position.y);
+
+    // Facteur de transparence pour l'invincibilité (40% si invincible)
+    float alphaFactor = isInvincible ? 0.4f : 1.0f;
+
+    // ===== SATELLITE =====
+    // Utiliser la position retardée pour le satellite
+    Vector2D delayedPosition = positionHistory[historyHead];
+
+    // Calculer la position du satellite avec effet de flottement et inertie
+    float floatOffset = 4.0f * FastMath::sin(satelliteFloatPhase);
+    int satX = static_cast<int>(delayedPosition.x + satelliteOffsetX + satelliteLagX);
+    int satY = static_cast<int>(delayedPosition.y + satelliteOffsetY + floatOffset + satelliteLagY);
+
+    // Ombre du satellite pour donner l'impression de profondeur
+    int shadowY = static_cast<int>(delayedPosition.y + satelliteOffsetY + satelliteLagY + 15);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, static_cast<Uint8>(30 * alphaFactor));
+    drawFilledCircle(renderer, satX, shadowY, satelliteRadius - 1);
+
+    // Halo orange du satellite (plus petit)
+    drawGradientCircle(renderer, satX, satY, satelliteRadius * 2, 255, 140, 0, static_cast<int>(40 * alphaFactor));
+
+    // Corps du satellite - orange foncé
+    SDL_SetRenderDrawColor(renderer, 200, 80, 0, static_cast<Uint8>(255 * alphaFactor));
+    drawFilledCircle(renderer, satX, satY, satelliteRadius);
+
+    // Centre lumineux orange
+    SDL_SetRenderDrawColor(renderer, 255, 140, 0, static_cast<Uint8>(255 * alphaFactor));
+    drawFilledCircle(renderer, satX, satY, satelliteRadius / 2);
+
+    // Petite brillance blanche
+    SDL_SetRenderDrawColor(renderer, 255, 200, 100, static_cast<Uint8>(255 * alphaFactor));
+    drawFilledCircle(renderer, satX - 1, satY - 1, satelliteRadius / 3);
+
+    // ===== JOUEUR =====
+    // Ombre du joueur - dessinée en premier pour être derrière le halo
+    // L'ombre utilise shadowGroundY qui reste fixe pendant le saut
+    int playerShadowY = static_cast<int>(shadowGroundY);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, static_cast<Uint8>(60 * alphaFactor));
+    drawFilledCircle(renderer, centerX, playerShadowY, radius + 2);
+
+    // Calculer la pulsation du halo (oscille entre 0.9 et 1.1)
+    float haloPulse = 1.0f + 0.1f * FastMath::sin(haloPhase);
+
+    // Dessiner les halos avec dégradé (du plus grand au plus petit)
+    // Halo externe 1 - très subtil, s'estompe complètement aux bords
+    int haloRadius1 = static_cast<int>(radius * 3.0f * haloPulse);
+    drawGradientCircle(renderer, centerX, centerY, haloRadius1, 255, 255, 255, static_cast<int>(30 * alphaFactor));
+
+    // Halo externe 2 - dégradé doux
+    int haloRadius2 = static_cast<int>(radius * 2.2f * haloPulse);
+    drawGradientCircle(renderer, centerX, centerY, haloRadius2, 255, 255, 255, static_cast<int>(50 * alphaFactor));
+
+    // Halo interne - plus intense
+    int haloRadius3 = static_cast<int>(radius * 1.5f);
+    drawGradientCircle(renderer, centerX, centerY, haloRadius3, 255, 255, 255, static_cast<int>(100 * alphaFactor));
+
+    // Bord lumineux de la boule
+    int glowRadius = static_cast<int>(radius * 1.2f);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(180 * alphaFactor));
+    drawFilledCircle(renderer, centerX, centerY, glowRadius);
+
+    // Coeur blanc brillant de la boule
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(255 * alphaFactor));
+    drawFilledCircle(renderer, centerX, centerY, radius);
+
+    // Centre ultra-lumineux (petit cercle au centre)
+    int coreRadius = static_cast<int>(radius * 0.5f);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(255 * alphaFactor));
+    drawFilledCircle(renderer, centerX, centerY, coreRadius);
+
+    // Si le joueur attaque, dessiner un éclair d'énergie
+    if (attacking) {
+        float attackIntensity = static_cast<float>(attackTimer) / attackDuration;
+
+        // Éclair d'énergie qui suit la direction
+        int energyLength = 30;
+        int energyWidth = 6;
+
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(200 * attackIntensity * alphaFactor));
+
+        switch (direction) {
+            case Direction::UP:
+                for (int i = 0; i < energyLength; i++) {
+                    int y = centerY - radius - i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int dx = -thickness; dx <= thickness; dx++) {
+                        SDL_RenderDrawPoint(renderer, centerX + dx, y);
+                    }
+                }
+                break;
+            case Direction::DOWN:
+                for (int i = 0; i < energyLength; i++) {
+                    int y = centerY + radius + i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int dx = -thickness; dx <= thickness; dx++) {
+                        SDL_RenderDrawPoint(renderer, centerX + dx, y);
+                    }
+                }
+                break;
+            case Direction::LEFT:
+                for (int i = 0; i < energyLength; i++) {
+                    int x = centerX - radius - i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int dy = -thickness; dy <= thickness; dy++) {
+                        SDL_RenderDrawPoint(renderer, x, centerY + dy);
+                    }
+                }
+                break;
+            case Direction::RIGHT:
+                for (int i = 0; i < energyLength; i++) {
+                    int x = centerX + radius + i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int dy = -thickness; dy <= thickness; dy++) {
+                        SDL_RenderDrawPoint(renderer, x, centerY + dy);
+                    }
+                }
+                break;
+            case Direction::UP_LEFT:
+                for (int i = 0; i < energyLength; i++) {
+                    int x = centerX - radius - i;
+                    int y = centerY - radius - i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int t = -thickness; t <= thickness; t++) {
+                        SDL_RenderDrawPoint(renderer, x + t, y - t);
+                        SDL_RenderDrawPoint(renderer, x - t, y + t);
+                    }
+                }
+                break;
+            case Direction::UP_RIGHT:
+                for (int i = 0; i < energyLength; i++) {
+                    int x = centerX + radius + i;
+                    int y = centerY - radius - i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int t = -thickness; t <= thickness; t++) {
+                        SDL_RenderDrawPoint(renderer, x - t, y - t);
+                        SDL_RenderDrawPoint(renderer, x + t, y + t);
+                    }
+                }
+                break;
+            case Direction::DOWN_LEFT:
+                for (int i = 0; i < energyLength; i++) {
+                    int x = centerX - radius - i;
+                    int y = centerY + radius + i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int t = -thickness; t <= thickness; t++) {
+                        SDL_RenderDrawPoint(renderer, x - t, y - t);
+                        SDL_RenderDrawPoint(renderer, x + t, y + t);
+                    }
+                }
+                break;
+            case Direction::DOWN_RIGHT:
+                for (int i = 0; i < energyLength; i++) {
+                    int x = centerX + radius + i;
+                    int y = centerY + radius + i;
+                    int thickness = energyWidth - (i * energyWidth / energyLength);
+                    for (int t = -thickness; t <= thickness; t++) {
+                        SDL_RenderDrawPoint(renderer, x + t, y - t);
+                        SDL_RenderDrawPoint(renderer, x - t, y + t);
+                    }
+                }
+                break;
+        }
+    }
+}
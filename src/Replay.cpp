@@ -0,0 +1,189 @@
+#include "Replay.hpp"
+#include <iostream>
+
+namespace {
+
+const char REPLAY_MAGIC[4] = {'A', 'B', 'R', 'P'};
+const uint8_t REPLAY_VERSION = 1;
+const uint8_t END_MARKER = 0xFF;
+
+} // namespace
+
+InputRecorder::InputRecorder()
+    : active(false), lastKeys(0), idleRun(0), frameCount(0) {}
+
+InputRecorder::~InputRecorder() {
+    close();
+}
+
+bool InputRecorder::open(const char* path, uint64_t seed) {
+    close();
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Erreur: Impossible de créer le replay " << path << std::endl;
+        return false;
+    }
+
+    file.write(REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+    file.put(static_cast<char>(REPLAY_VERSION));
+    for (int i = 0; i < 8; i++) {
+        file.put(static_cast<char>((seed >> (8 * i)) & 0xFF));
+    }
+
+    active = true;
+    lastKeys = 0;
+    idleRun = 0;
+    frameCount = 0;
+    return true;
+}
+
+void InputRecorder::writeVarint(uint32_t value) {
+    while (value >= 0x80) {
+        file.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    file.put(static_cast<char>(value));
+}
+
+void InputRecorder::recordFrame(const InputFrame& frame) {
+    if (!active) return;
+    frameCount++;
+
+    // Frame identique à la précédente : seulement allonger la série
+    if (frame.heldKeys == lastKeys && frame.eventCount == 0) {
+        idleRun++;
+        return;
+    }
+
+    writeVarint(idleRun);
+    idleRun = 0;
+
+    file.put(static_cast<char>(frame.heldKeys));
+    writeVarint(static_cast<uint32_t>(frame.eventCount));
+    for (int i = 0; i < frame.eventCount; i++) {
+        writeVarint(frame.events[i].type);
+        writeVarint(static_cast<uint32_t>(frame.events[i].key));
+    }
+    lastKeys = frame.heldKeys;
+}
+
+void InputRecorder::close() {
+    if (!active) return;
+
+    writeVarint(idleRun);
+    file.put(static_cast<char>(END_MARKER));
+    file.close();
+    active = false;
+
+    std::cout << "Replay enregistré : " << frameCount << " frames" << std::endl;
+}
+
+InputReplay::InputReplay()
+    : active(false), seed(0), lastKeys(0), idleRun(0), frameCount(0) {}
+
+bool InputReplay::open(const char* path) {
+    close();
+
+    file.open(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erreur: Impossible d'ouvrir le replay " << path << std::endl;
+        return false;
+    }
+
+    char magic[sizeof(REPLAY_MAGIC)];
+    file.read(magic, sizeof(magic));
+    int version = file.get();
+    if (!file || std::char_traits<char>::compare(magic, REPLAY_MAGIC, sizeof(magic)) != 0) {
+        std::cerr << "Erreur: " << path << " n'est pas un fichier de replay" << std::endl;
+        file.close();
+        return false;
+    }
+    if (version != REPLAY_VERSION) {
+        std::cerr << "Erreur: version de replay non supportée (" << version << ")" << std::endl;
+        file.close();
+        return false;
+    }
+
+    seed = 0;
+    for (int i = 0; i < 8; i++) {
+        seed |= static_cast<uint64_t>(static_cast<uint8_t>(file.get())) << (8 * i);
+    }
+
+    lastKeys = 0;
+    frameCount = 0;
+    if (!readVarint(idleRun)) {
+        std::cerr << "Erreur: replay " << path << " tronqué" << std::endl;
+        file.close();
+        return false;
+    }
+
+    active = true;
+    return true;
+}
+
+bool InputReplay::readVarint(uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        int byte = file.get();
+        if (byte == std::char_traits<char>::eof()) {
+            return false;
+        }
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool InputReplay::nextFrame(InputFrame& frame) {
+    if (!active) return false;
+
+    frame.clear();
+
+    if (idleRun > 0) {
+        idleRun--;
+        frame.heldKeys = lastKeys;
+        frameCount++;
+        return true;
+    }
+
+    int keys = file.get();
+    if (keys == std::char_traits<char>::eof() || keys == END_MARKER) {
+        close();
+        return false;
+    }
+
+    uint32_t eventCount = 0;
+    if (!readVarint(eventCount)) {
+        close();
+        return false;
+    }
+    for (uint32_t i = 0; i < eventCount; i++) {
+        uint32_t type = 0;
+        uint32_t key = 0;
+        if (!readVarint(type) || !readVarint(key)) {
+            close();
+            return false;
+        }
+        frame.addEvent(type, static_cast<int32_t>(key));
+    }
+
+    frame.heldKeys = static_cast<uint8_t>(keys);
+    lastKeys = frame.heldKeys;
+    frameCount++;
+
+    // Longueur de la série qui suit cette frame
+    if (!readVarint(idleRun)) {
+        idleRun = 0;
+    }
+    return true;
+}
+
+void InputReplay::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+    active = false;
+}
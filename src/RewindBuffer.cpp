@@ -0,0 +1,231 @@
+#include "RewindBuffer.hpp"
+#include <cstring>
+
+namespace {
+
+// Au moins 4 zéros consécutifs interrompent une plage littérale
+const size_t MIN_ZERO_RUN = 4;
+
+uint8_t* writeVarint(uint8_t* out, size_t value) {
+    while (value >= 0x80) {
+        *out++ = static_cast<uint8_t>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(value);
+    return out;
+}
+
+const uint8_t* readVarint(const uint8_t* in, size_t& value) {
+    value = 0;
+    int shift = 0;
+    while (*in & 0x80) {
+        value |= static_cast<size_t>(*in++ & 0x7F) << shift;
+        shift += 7;
+    }
+    value |= static_cast<size_t>(*in++) << shift;
+    return in;
+}
+
+} // namespace
+
+RewindBuffer::RewindBuffer(size_t stateSize, int capacityFrames, int keyframeInterval, size_t budgetBytes)
+    : stateSize(stateSize),
+      capacity(capacityFrames > 1 ? capacityFrames : 2),
+      keyframeInterval(keyframeInterval > 0 ? keyframeInterval : 1),
+      writePos(0),
+      usedBytes(0),
+      head(0),
+      count(0),
+      framesSinceKey(0) {
+
+    // Pire cas d'un encodage : plages littérales courtes et en-têtes
+    scratch.resize(2 * stateSize + 16);
+
+    // Le budget doit contenir au moins deux frames (delta + image clé)
+    size_t minimumBudget = 2 * scratch.size();
+    arena.resize(budgetBytes > minimumBudget ? budgetBytes : minimumBudget);
+
+    records.resize(capacity);
+    current.resize(stateSize);
+}
+
+RewindBuffer::~RewindBuffer() {}
+
+void RewindBuffer::clear() {
+    writePos = 0;
+    usedBytes = 0;
+    head = 0;
+    count = 0;
+    framesSinceKey = 0;
+}
+
+size_t RewindBuffer::encode(const uint8_t* state, const uint8_t* reference, uint8_t* out) const {
+    // Suite de (plage de zéros, plage littérale) sur state XOR reference
+    uint8_t* start = out;
+    size_t pos = 0;
+
+    while (pos < stateSize) {
+        size_t zeroStart = pos;
+        while (pos < stateSize && state[pos] == (reference ? reference[pos] : 0)) {
+            pos++;
+        }
+        size_t zeros = pos - zeroStart;
+
+        size_t literalStart = pos;
+        size_t zeroRun = 0;
+        while (pos < stateSize && zeroRun < MIN_ZERO_RUN) {
+            zeroRun = (state[pos] == (reference ? reference[pos] : 0)) ? zeroRun + 1 : 0;
+            pos++;
+        }
+        // Les zéros de fin de plage appartiennent à la plage suivante
+        if (zeroRun > 0) {
+            pos -= zeroRun;
+        }
+        size_t literals = pos - literalStart;
+
+        out = writeVarint(out, zeros);
+        out = writeVarint(out, literals);
+        for (size_t i = literalStart; i < pos; i++) {
+            *out++ = reference ? (state[i] ^ reference[i]) : state[i];
+        }
+    }
+
+    return static_cast<size_t>(out - start);
+}
+
+void RewindBuffer::applyXor(const uint8_t* data, size_t size, uint8_t* state) const {
+    const uint8_t* end = data + size;
+    size_t pos = 0;
+
+    while (data < end) {
+        size_t zeros;
+        size_t literals;
+        data = readVarint(data, zeros);
+        data = readVarint(data, literals);
+        pos += zeros;
+        for (size_t i = 0; i < literals; i++) {
+            state[pos++] ^= *data++;
+        }
+    }
+}
+
+void RewindBuffer::evictOldest() {
+    Record& oldest = recordAt(0);
+    usedBytes -= oldest.deltaSize + oldest.keySize;
+    head = (head + 1) % capacity;
+    count--;
+}
+
+uint8_t* RewindBuffer::allocate(size_t size) {
+    if (count == capacity) {
+        evictOldest();
+    }
+
+    // Les enregistrements occupent l'arène dans l'ordre d'arrivée, de la
+    // plus ancienne frame jusqu'à writePos, en repartant au début si besoin
+    while (count > 0) {
+        size_t oldest = recordAt(0).offset;
+
+        if (writePos > oldest) {
+            // Libre : [writePos, fin) puis [0, oldest)
+            if (size <= arena.size() - writePos) {
+                return &arena[writePos];
+            }
+            if (size <= oldest) {
+                writePos = 0;
+                return &arena[0];
+            }
+        } else if (writePos < oldest && size <= oldest - writePos) {
+            // Libre : [writePos, oldest)
+            return &arena[writePos];
+        }
+
+        evictOldest();
+    }
+
+    writePos = 0;
+    return &arena[0];
+}
+
+void RewindBuffer::push(const void* state) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(state);
+    bool first = (count == 0);
+    bool keyframe = first || framesSinceKey + 1 >= keyframeInterval;
+
+    // Delta avec la frame précédente, puis image clé éventuelle
+    size_t deltaSize = first ? 0 : encode(bytes, current.data(), scratch.data());
+    size_t keySize = keyframe ? encode(bytes, nullptr, scratch.data() + deltaSize) : 0;
+    size_t size = deltaSize + keySize;
+
+    uint8_t* destination = allocate(size);
+    std::memcpy(destination, scratch.data(), size);
+
+    Record& record = records[(head + count) % capacity];
+    record.offset = static_cast<uint32_t>(destination - arena.data());
+    record.deltaSize = static_cast<uint32_t>(deltaSize);
+    record.keySize = static_cast<uint32_t>(keySize);
+    count++;
+
+    writePos = record.offset + size;
+    usedBytes += size;
+    framesSinceKey = keyframe ? 0 : framesSinceKey + 1;
+
+    std::memcpy(current.data(), bytes, stateSize);
+}
+
+bool RewindBuffer::stepBack(void* state) {
+    if (count < 2) {
+        return false;
+    }
+
+    // Le delta de la frame la plus récente ramène à la précédente
+    Record& newest = recordAt(count - 1);
+    applyXor(&arena[newest.offset], newest.deltaSize, current.data());
+
+    writePos = newest.offset;
+    usedBytes -= newest.deltaSize + newest.keySize;
+    count--;
+
+    // Prochaine image clé comptée depuis la dernière conservée
+    framesSinceKey = 0;
+    for (int i = count - 1; i >= 0 && recordAt(i).keySize == 0; i--) {
+        framesSinceKey++;
+    }
+
+    std::memcpy(state, current.data(), stateSize);
+    return true;
+}
+
+bool RewindBuffer::peek(int framesAgo, void* state) {
+    if (framesAgo < 0 || framesAgo >= count) {
+        return false;
+    }
+
+    int target = count - 1 - framesAgo;
+    uint8_t* out = static_cast<uint8_t*>(state);
+
+    // Image clé la plus proche avant la cible
+    int key = target;
+    while (key >= 0 && recordAt(key).keySize == 0) {
+        key--;
+    }
+
+    if (key >= 0 && target - key < framesAgo) {
+        // En avant depuis l'image clé
+        Record& keyRecord = recordAt(key);
+        std::memset(out, 0, stateSize);
+        applyXor(&arena[keyRecord.offset + keyRecord.deltaSize], keyRecord.keySize, out);
+        for (int i = key + 1; i <= target; i++) {
+            Record& record = recordAt(i);
+            applyXor(&arena[record.offset], record.deltaSize, out);
+        }
+    } else {
+        // En arrière depuis la frame courante
+        std::memcpy(out, current.data(), stateSize);
+        for (int i = count - 1; i > target; i--) {
+            Record& record = recordAt(i);
+            applyXor(&arena[record.offset], record.deltaSize, out);
+        }
+    }
+    return true;
+}
@@ -1,66 +1,103 @@
 #include "Room.hpp"
 #include "Player.hpp"
+#include "Snapshot.hpp"
+#include "SimMath.hpp"
+#include "Collision.hpp"
+#include "VectorBatch.hpp"
 #include <cstdlib>
-#include <ctime>
 #include <cmath>
-#include <string>
+#include <cstdio>
+#include <cstring>
 #include <algorithm>
 
-Room::Room(int screenWidth, int screenHeight, int level, Difficulty difficulty)
+namespace {
+
+// Zone de jeu pour les trous (éviter les bords et les zones de départ/arrivée)
+const int HOLE_START_ZONE = 150;    // Zone de départ à gauche
+const int HOLE_END_ZONE = 150;      // Zone d'arrivée à droite
+const int HOLE_TOP_MARGIN = 100;
+const int HOLE_BOTTOM_MARGIN = 100;
+
+} // namespace
+
+Room::Room(int screenWidth, int screenHeight, int level, Difficulty difficulty, uint64_t runSeed)
     : screenWidth(screenWidth),
       screenHeight(screenHeight),
-      level(level),
-      difficulty(difficulty),
       endZoneX(screenWidth - 100),
-      elapsedTime(0.0f),
-      timerRunning(false),
-      celebrating(false),
-      celebrationTime(0.0f),
-      arrowAnimPhase(0.0f),
       electricStarPos(screenWidth / 2, screenHeight / 2),
       electricStarRadius(15),
-      electricAnimPhase(0.0f),
-      satelliteStarPos(0, 0),
-      satelliteOrbitAngle(0.0f),
       satelliteOrbitSpeed(0.02f),
-      satelliteOrbitRadius((screenWidth - 80) / 4.0f) {
+      satelliteOrbitRadius((screenWidth - 80) / 4.0f),
+      hazards(screenWidth, screenHeight) {
 
     // Le rayon d'un trou est le double de la taille du joueur (rayon du joueur = 8)
     holeRadius = 16;
 
-    // Initialiser le générateur de nombres aléatoires
-    static bool seeded = false;
-    if (!seeded) {
-        srand(static_cast<unsigned int>(time(nullptr)));
-        seeded = true;
-    }
+    // Réserver une fois pour toutes : les niveaux suivants ne réallouent pas
+    holes.reserve(maxHoleCount());
+    holeX.reserve(maxHoleCount());
+    holeY.reserve(maxHoleCount());
+    holeRadii.reserve(maxHoleCount());
+    particles.reserve(CELEBRATION_PARTICLES);
+
+    reset(level, difficulty, runSeed);
+}
+
+Room::~Room() {}
+
+void Room::reset(int newLevel, Difficulty newDifficulty, uint64_t runSeed) {
+    level = newLevel;
+    difficulty = newDifficulty;
 
-    // Initialiser les angles des éclairs de l'étoile électrique (8 éclairs)
-    for (int i = 0; i < 8; i++) {
-        boltAngles.push_back((i * 45.0f) * M_PI / 180.0f);
+    int difficultyValue = static_cast<int>(difficulty);
+    holeRandom.seed(Random::deriveSeed(runSeed, RandomStream::HOLES, level, difficultyValue));
+    particleRandom.seed(Random::deriveSeed(runSeed, RandomStream::PARTICLES, level, difficultyValue));
+
+    elapsedTime = 0.0f;
+    timerRunning = false;
+    celebrating = false;
+    celebrationTime = 0.0f;
+    particles.clear();
+
+    arrowAnimPhase = 0.0f;
+    electricAnimPhase = 0.0f;
+
+    hazards.clear();
+    hazards.addStatic(electricStarPos, static_cast<float>(electricStarRadius));
+    satelliteHazard = -1;
+    if (difficulty == Difficulty::HARD) {
+        satelliteHazard = hazards.addOrbit(electricStarPos, satelliteOrbitRadius, satelliteOrbitSpeed,
+                                           static_cast<float>(electricStarRadius));
     }
 
     generateHoles();
 }
 
-Room::~Room() {}
+int Room::maxHoleCount() const {
+    // Le nombre de trous demandé (3 * niveau * difficulté) croît sans limite,
+    // mais l'espacement minimal (3 * rayon) borne ce qui tient dans la zone :
+    // des disques disjoints de rayon 1.5 * holeRadius centrés dans la zone
+    // élargie de 1.5 * holeRadius de chaque côté
+    float halfSpacing = holeRadius * 1.5f;
+    float areaWidth = (screenWidth - HOLE_START_ZONE - HOLE_END_ZONE) + 2.0f * halfSpacing;
+    float areaHeight = (screenHeight - HOLE_TOP_MARGIN - HOLE_BOTTOM_MARGIN) + 2.0f * halfSpacing;
+    float diskArea = static_cast<float>(M_PI) * halfSpacing * halfSpacing;
+    return static_cast<int>(areaWidth * areaHeight / diskArea) + 1;
+}
 
 void Room::generateHoles() {
     holes.clear();
+    holeX.clear();
+    holeY.clear();
+    holeRadii.clear();
 
     // Nombre de trous = 3 * niveau * difficulté
     int numHoles = 3 * level * static_cast<int>(difficulty);
 
-    // Zone de jeu pour les trous (éviter les bords et les zones de départ/arrivée)
-    int startZone = 150;  // Zone de départ à gauche
-    int endZone = 150;    // Zone d'arrivée à droite
-    int topMargin = 100;
-    int bottomMargin = 100;
-
-    int minX = startZone;
-    int maxX = screenWidth - endZone;
-    int minY = topMargin;
-    int maxY = screenHeight - bottomMargin;
+    int minX = HOLE_START_ZONE;
+    int maxX = screenWidth - HOLE_END_ZONE;
+    int minY = HOLE_TOP_MARGIN;
+    int maxY = screenHeight - HOLE_BOTTOM_MARGIN;
 
     // Générer les trous aléatoirement
     for (int i = 0; i < numHoles; i++) {
@@ -71,36 +108,39 @@ void Room::generateHoles() {
 
         // Trouver une position valide (pas trop proche des autres trous)
         while (!validPosition && attempts < maxAttempts) {
-            newPos.x = static_cast<float>(minX + rand() % (maxX - minX));
-            newPos.y = static_cast<float>(minY + rand() % (maxY - minY));
+            newPos.x = static_cast<float>(holeRandom.range(minX, maxX));
+            newPos.y = static_cast<float>(holeRandom.range(minY, maxY));
 
             validPosition = true;
 
-            // Vérifier la distance avec les autres trous
-            for (const auto& hole : holes) {
-                float dx = newPos.x - hole.position.x;
-                float dy = newPos.y - hole.position.y;
-                float distance = std::sqrt(dx * dx + dy * dy);
-
-                // Distance minimale entre les trous = 3 * rayon du trou
-                if (distance < holeRadius * 3) {
-                    validPosition = false;
-                    break;
-                }
+            // Distance minimale entre les trous = 3 * rayon du trou (positions
+            // entières : comparer les carrés revient à comparer les distances)
+            float nearestSq;
+            if (VectorBatch::nearest(newPos.x, newPos.y, holeX.data(), holeY.data(),
+                                     static_cast<int>(holes.size()), &nearestSq) >= 0) {
+                float minSpacing = static_cast<float>(holeRadius * 3);
+                validPosition = nearestSq >= minSpacing * minSpacing;
             }
 
             attempts++;
         }
 
         if (validPosition) {
-            Hole hole;
-            hole.position = newPos;
-            hole.radius = holeRadius;
-            holes.push_back(hole);
+            addHole(newPos, holeRadius);
         }
     }
 }
 
+void Room::addHole(const Vector2D& position, int radius) {
+    Hole hole;
+    hole.position = position;
+    hole.radius = radius;
+    holes.push_back(hole);
+    holeX.push_back(position.x);
+    holeY.push_back(position.y);
+    holeRadii.push_back(static_cast<float>(radius));
+}
+
 void Room::startTimer() {
     timerRunning = true;
     elapsedTime = 0.0f;
@@ -136,17 +176,8 @@ void Room::update(float deltaTime) {
         electricAnimPhase -= 2 * M_PI;
     }
 
-    // Mettre à jour l'étoile satellite (mode difficile uniquement)
-    if (difficulty == Difficulty::HARD) {
-        satelliteOrbitAngle += satelliteOrbitSpeed;
-        if (satelliteOrbitAngle > 2 * M_PI) {
-            satelliteOrbitAngle -= 2 * M_PI;
-        }
-
-        // Calculer la position de l'étoile satellite
-        satelliteStarPos.x = electricStarPos.x + satelliteOrbitRadius * std::cos(satelliteOrbitAngle);
-        satelliteStarPos.y = electricStarPos.y + satelliteOrbitRadius * std::sin(satelliteOrbitAngle);
-    }
+    // Déplacer les étoiles (orbites, patrouilles, pulsations)
+    hazards.update();
 
     // Mettre à jour la célébration
     if (celebrating) {
@@ -168,77 +199,23 @@ void Room::update(float deltaTime) {
     }
 }
 
-void Room::drawArrow(SDL_Renderer* renderer, int x, int y, int size) {
-    // Dessiner une flèche pointant vers la droite avec une pointe bien visible
-
-    // Ombre de la flèche (décalée uniquement vers le bas, même position horizontale)
-    int shadowOffsetX = 0;
-    int shadowOffsetY = 12;
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 100); // Noir semi-transparent
-
-    // Ombre du corps
-    SDL_Rect shadowBody = {x - size/2 + shadowOffsetX, y - size/6 + shadowOffsetY, size, size/3};
-    SDL_RenderFillRect(renderer, &shadowBody);
-
-    // Ombre de la pointe
-    for (int i = 0; i < size/2; i++) {
-        int height = size - i * 2;
-        for (int j = 0; j < height; j++) {
-            SDL_RenderDrawPoint(renderer, x + size/2 + i + shadowOffsetX, y - height/2 + j + shadowOffsetY);
-        }
-    }
-
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-
-    // Corps de la flèche (rectangle)
-    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Jaune vif
-    SDL_Rect arrowBody = {x - size/2, y - size/6, size, size/3};
-    SDL_RenderFillRect(renderer, &arrowBody);
-
-    // Pointe de la flèche (triangle)
-    for (int i = 0; i < size/2; i++) {
-        int height = size - i * 2;
-        for (int j = 0; j < height; j++) {
-            SDL_RenderDrawPoint(renderer, x + size/2 + i, y - height/2 + j);
-        }
-    }
-
-    // Contour noir pour mieux voir la flèche
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-
-    // Contour du corps
-    SDL_Rect outlineBody = {x - size/2 - 1, y - size/6 - 1, size + 2, size/3 + 2};
-    SDL_RenderDrawRect(renderer, &outlineBody);
-
-    // Contour de la pointe (lignes)
-    // Ligne supérieure
-    for (int i = 0; i <= size/2; i++) {
-        SDL_RenderDrawPoint(renderer, x + size/2 + i, y - (size - i * 2)/2 - 1);
-    }
-    // Ligne inférieure
-    for (int i = 0; i <= size/2; i++) {
-        SDL_RenderDrawPoint(renderer, x + size/2 + i, y + (size - i * 2)/2 + 1);
-    }
-}
-
 void Room::createCelebrationParticles(const Vector2D& position) {
     celebrating = true;
     celebrationTime = 0.0f;
 
     // Créer des particules colorées
-    for (int i = 0; i < 50; i++) {
+    for (int i = 0; i < CELEBRATION_PARTICLES; i++) {
         Particle p;
         p.position = position;
 
         // Vitesse aléatoire dans toutes les directions (vers le haut principalement)
-        float angle = (rand() % 360) * M_PI / 180.0f;
-        float speed = 100.0f + (rand() % 200);
-        p.velocity.x = cos(angle) * speed;
-        p.velocity.y = -abs(sin(angle) * speed); // Vers le haut
+        SimReal angle = SimReal(particleRandom.nextInt(360)) * SimReal(static_cast<float>(M_PI / 180.0));
+        SimReal speed = SimReal(100 + particleRandom.nextInt(200));
+        p.velocity.x = simFloat(simCos(angle) * speed);
+        p.velocity.y = -abs(simFloat(simSin(angle) * speed)); // Vers le haut
 
         // Couleurs aléatoires vives
-        int colorChoice = rand() % 5;
+        int colorChoice = particleRandom.nextInt(5);
         switch (colorChoice) {
             case 0: p.r = 255; p.g = 0; p.b = 0; break;     // Rouge
             case 1: p.r = 255; p.g = 255; p.b = 0; break;   // Jaune
@@ -247,599 +224,38 @@ void Room::createCelebrationParticles(const Vector2D& position) {
             case 4: p.r = 255; p.g = 0; p.b = 255; break;   // Magenta
         }
 
-        p.life = 1.0f + (rand() % 100) / 100.0f;
+        p.life = 1.0f + particleRandom.nextInt(100) / 100.0f;
         p.maxLife = p.life;
 
         particles.push_back(p);
     }
 }
 
-void Room::drawNumber(SDL_Renderer* renderer, int number, int x, int y, int size) {
-    // Convertir le nombre en string
-    std::string numStr = std::to_string(number);
-
-    int currentX = x;
-    int digitWidth = size * 6;
-    int digitSpacing = size * 2;
-
-    for (char digit : numStr) {
-        // Vérifier que c'est bien un chiffre
-        if (digit < '0' || digit > '9') {
-            // Si ce n'est pas un chiffre, sauter mais ne rien dessiner
-            currentX += digitWidth + digitSpacing;
-            continue;
-        }
-
-        int d = digit - '0';
-
-        // Dessiner chaque chiffre pixel par pixel
-        for (int py = 0; py < 7; py++) {
-            for (int px = 0; px < 5; px++) {
-                bool drawPixel = false;
-
-                // Patterns pour chaque chiffre
-                switch (d) {
-                    case 0:
-                        drawPixel = (py == 0 && px > 0 && px < 4) ||
-                                   (py == 6 && px > 0 && px < 4) ||
-                                   ((px == 0 || px == 4) && py > 0 && py < 6);
-                        break;
-                    case 1:
-                        drawPixel = (px == 2) || (py == 6);
-                        break;
-                    case 2:
-                        drawPixel = (py == 0) || (py == 3) || (py == 6) ||
-                                   (px == 4 && py > 0 && py < 3) ||
-                                   (px == 0 && py > 3 && py < 6);
-                        break;
-                    case 3:
-                        drawPixel = (py == 0) || (py == 3) || (py == 6) ||
-                                   (px == 4 && py > 0 && py < 6);
-                        break;
-                    case 4:
-                        drawPixel = (px == 4) || (py == 3) ||
-                                   (px == 0 && py < 3);
-                        break;
-                    case 5:
-                        drawPixel = (py == 0) || (py == 3) || (py == 6) ||
-                                   (px == 0 && py > 0 && py < 3) ||
-                                   (px == 4 && py > 3 && py < 6);
-                        break;
-                    case 6:
-                        drawPixel = (py == 0 && px > 0) || (py == 3) || (py == 6 && px > 0 && px < 4) ||
-                                   (px == 0 && py > 0) ||
-                                   (px == 4 && py > 3 && py < 6);
-                        break;
-                    case 7:
-                        drawPixel = (py == 0) || (px == 4 && py > 0);
-                        break;
-                    case 8:
-                        drawPixel = (py == 0) || (py == 3) || (py == 6) ||
-                                   (px == 0 && py > 0 && py < 6) ||
-                                   (px == 4 && py > 0 && py < 6);
-                        break;
-                    case 9:
-                        drawPixel = (py == 0) || (py == 3) || (py == 6 && px < 4) ||
-                                   (px == 0 && py > 0 && py < 3) ||
-                                   (px == 4);
-                        break;
-                }
-
-                if (drawPixel) {
-                    for (int sy = 0; sy < size; sy++) {
-                        for (int sx = 0; sx < size; sx++) {
-                            SDL_RenderDrawPoint(renderer,
-                                              currentX + px * size + sx,
-                                              y + py * size + sy);
-                        }
-                    }
-                }
-            }
-        }
-
-        currentX += digitWidth + digitSpacing;
-    }
-}
-
-void Room::drawHeart(SDL_Renderer* renderer, int x, int y, int size, int quarters) {
-    // Dessiner un cœur pixel art avec support des quarts
-    // quarters: 0 = vide, 1 = 1/4, 2 = 2/4, 3 = 3/4, 4 = plein
-
-    // Pattern du cœur (8x8)
-    bool heartPattern[8][8] = {
-        {0,1,1,0,0,1,1,0},
-        {1,1,1,1,1,1,1,1},
-        {1,1,1,1,1,1,1,1},
-        {1,1,1,1,1,1,1,1},
-        {0,1,1,1,1,1,1,0},
-        {0,0,1,1,1,1,0,0},
-        {0,0,0,1,1,0,0,0},
-        {0,0,0,0,0,0,0,0}
-    };
-
-    for (int py = 0; py < 8; py++) {
-        for (int px = 0; px < 8; px++) {
-            if (heartPattern[py][px]) {
-                // Déterminer si ce pixel doit être rempli selon le niveau de quarts
-                bool shouldFill = false;
-
-                if (quarters == 4) {
-                    // Cœur complètement plein
-                    shouldFill = true;
-                } else if (quarters == 3) {
-                    // 3/4 plein - remplir tout sauf le quart supérieur droit
-                    shouldFill = !(px >= 4 && py < 2);
-                } else if (quarters == 2) {
-                    // 2/4 plein - remplir la moitié inférieure
-                    shouldFill = (py >= 4);
-                } else if (quarters == 1) {
-                    // 1/4 plein - remplir le quart inférieur
-                    shouldFill = (py >= 6);
-                }
-
-                if (shouldFill) {
-                    // Partie remplie (rouge)
-                    SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-                } else {
-                    // Partie vide ou contour (gris)
-                    SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255);
-                }
-
-                for (int sy = 0; sy < size; sy++) {
-                    for (int sx = 0; sx < size; sx++) {
-                        SDL_RenderDrawPoint(renderer,
-                                          x + px * size + sx,
-                                          y + py * size + sy);
-                    }
-                }
-            }
-        }
-    }
-}
-
-void Room::render(SDL_Renderer* renderer) {
-    // Fond de la salle (couleur légèrement différente)
-    SDL_SetRenderDrawColor(renderer, 40, 40, 50, 255);
-    SDL_RenderClear(renderer);
-
-    // Dessiner la zone de départ (gauche) en vert
-    SDL_SetRenderDrawColor(renderer, 0, 100, 0, 255);
-    SDL_Rect startZone = {0, 0, 100, screenHeight};
-    SDL_RenderFillRect(renderer, &startZone);
-
-    // Dessiner les flèches dans la zone de départ
-    int arrowSize = 20;
-    float animOffset = sin(arrowAnimPhase) * 10.0f;
-
-    // Dessiner 3 flèches animées
-    for (int i = 0; i < 3; i++) {
-        int arrowY = screenHeight / 4 + i * screenHeight / 4;
-        drawArrow(renderer, 30 + static_cast<int>(animOffset), arrowY - arrowSize/2, arrowSize);
-    }
-
-    // Dessiner la zone d'arrivée (droite) avec des lignes verticales (damier)
-    SDL_SetRenderDrawColor(renderer, 0, 0, 150, 255);
-    SDL_Rect endZone = {screenWidth - 100, 0, 100, screenHeight};
-    SDL_RenderFillRect(renderer, &endZone);
-
-    // Lignes blanches de la ligne d'arrivée
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-    for (int y = 0; y < screenHeight; y += 40) {
-        for (int x = 0; x < 100; x += 20) {
-            SDL_Rect checkRect = {screenWidth - 100 + x, y, 20, 20};
-            if ((x / 20 + y / 40) % 2 == 0) {
-                SDL_RenderFillRect(renderer, &checkRect);
-            }
-        }
-    }
-
-    // Dessiner les trous (noir avec bordure rouge) - Optimisé avec lignes horizontales
-    for (const auto& hole : holes) {
-        int centerX = static_cast<int>(hole.position.x);
-        int centerY = static_cast<int>(hole.position.y);
-
-        // Dessiner le cercle noir du trou avec des lignes horizontales (beaucoup plus rapide)
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        int radiusSq = hole.radius * hole.radius;
-        for (int y = -hole.radius; y <= hole.radius; y++) {
-            int halfWidth = static_cast<int>(std::sqrt(radiusSq - y * y));
-            SDL_RenderDrawLine(renderer,
-                             centerX - halfWidth, centerY + y,
-                             centerX + halfWidth, centerY + y);
-        }
-
-        // Bordure rouge avec lignes horizontales
-        SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
-        int outerRadius = hole.radius + 2;
-        int outerRadiusSq = outerRadius * outerRadius;
-        for (int y = -outerRadius; y <= outerRadius; y++) {
-            int outerHalfWidth = static_cast<int>(std::sqrt(outerRadiusSq - y * y));
-            int innerHalfWidth = (y >= -hole.radius && y <= hole.radius) ?
-                               static_cast<int>(std::sqrt(radiusSq - y * y)) : 0;
-
-            // Dessiner les deux segments de bordure (gauche et droite)
-            if (outerHalfWidth > innerHalfWidth) {
-                SDL_RenderDrawLine(renderer,
-                                 centerX - outerHalfWidth, centerY + y,
-                                 centerX - innerHalfWidth, centerY + y);
-                SDL_RenderDrawLine(renderer,
-                                 centerX + innerHalfWidth, centerY + y,
-                                 centerX + outerHalfWidth, centerY + y);
-            }
-        }
-    }
-
-    // Dessiner l'étoile électrique centrale
-    drawElectricStar(renderer);
-
-    // Dessiner l'étoile électrique satellite (mode difficile uniquement)
-    if (difficulty == Difficulty::HARD) {
-        // Sauvegarder la position actuelle de l'étoile centrale
-        Vector2D tempPos = electricStarPos;
-
-        // Remplacer temporairement par la position satellite
-        electricStarPos = satelliteStarPos;
-
-        // Dessiner l'étoile satellite
-        drawElectricStar(renderer);
-
-        // Restaurer la position centrale
-        electricStarPos = tempPos;
-    }
-
-    // Dessiner les particules de célébration
-    for (const auto& particle : particles) {
-        float alpha = particle.life / particle.maxLife;
-        SDL_SetRenderDrawColor(renderer,
-                              particle.r,
-                              particle.g,
-                              particle.b,
-                              static_cast<Uint8>(255 * alpha));
-
-        // Dessiner une petite étoile pour chaque particule
-        int px = static_cast<int>(particle.position.x);
-        int py = static_cast<int>(particle.position.y);
-
-        // Croix de 5 pixels
-        for (int i = -2; i <= 2; i++) {
-            SDL_RenderDrawPoint(renderer, px + i, py);
-            SDL_RenderDrawPoint(renderer, px, py + i);
-        }
-        // Diagonales
-        SDL_RenderDrawPoint(renderer, px + 1, py + 1);
-        SDL_RenderDrawPoint(renderer, px - 1, py - 1);
-        SDL_RenderDrawPoint(renderer, px + 1, py - 1);
-        SDL_RenderDrawPoint(renderer, px - 1, py + 1);
-    }
-}
-
-void Room::renderHUD(SDL_Renderer* renderer, int totalScore, float totalTime, int playerHealth, bool gameOver) {
-    // Afficher le texte d'instruction en haut de l'écran (en premier plan, après le brouillard)
-    std::string instruction = "Rejoins l'autre cote";
-    int textSize = 2;
-    int charWidth = 8 * textSize;
-    int spacing = 2 * textSize;
-    int textWidth = instruction.length() * (charWidth + spacing);
-    int textX = (screenWidth - textWidth) / 2;
-    int textY = 15;
-
-    SDL_SetRenderDrawColor(renderer, 255, 255, 100, 255);  // Jaune clair
-    drawText(renderer, instruction, textX, textY, textSize);
-
-
-    // Afficher les cœurs en haut à gauche
-    // playerHealth est en quarts de cœur (12 = 3 cœurs pleins, 11 = 2 cœurs pleins + 3/4, etc.)
-    int heartSize = 2;
-    int heartSpacing = heartSize * 10;
-
-    for (int i = 0; i < 3; i++) {
-        // Calculer le nombre de quarts pour ce cœur
-        int quartersForThisHeart = playerHealth - (i * 4);
-
-        // Limiter entre 0 et 4
-        if (quartersForThisHeart > 4) {
-            quartersForThisHeart = 4;
-        } else if (quartersForThisHeart < 0) {
-            quartersForThisHeart = 0;
-        }
-
-        drawHeart(renderer, 20 + i * heartSpacing, 20, heartSize, quartersForThisHeart);
-    }
-
-    // Afficher le temps total + temps du niveau actuel en haut à droite
-    if (timerRunning || celebrating || gameOver) {
-        int displayTime = static_cast<int>(totalTime + elapsedTime);
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        drawNumber(renderer, displayTime, screenWidth - 100, 20, 2);
-
-        // Ajouter "s" pour secondes (dessin simple)
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        int sX = screenWidth - 40;
-        int sY = 20;
-        // Dessiner un "S" simplifié
-        for (int py = 0; py < 7; py++) {
-            for (int px = 0; px < 5; px++) {
-                bool drawPixel = (py == 0 && px > 0) ||
-                               (px == 0 && py > 0 && py < 3) ||
-                               (py == 3 && px > 0 && px < 4) ||
-                               (px == 4 && py > 3 && py < 6) ||
-                               (py == 6 && px < 4);
-                if (drawPixel) {
-                    for (int sy = 0; sy < 2; sy++) {
-                        for (int sx = 0; sx < 2; sx++) {
-                            SDL_RenderDrawPoint(renderer, sX + px * 2 + sx, sY + py * 2 + sy);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Afficher le score total + score du niveau actuel dans une fenêtre en surbrillance à gauche
-    if (timerRunning || celebrating || gameOver) {
-        int currentLevelScore = getScore();
-        int displayScore = totalScore + currentLevelScore;
-
-        // Position de la fenêtre de score
-        int boxX = 15;
-        int boxY = screenHeight - 80;
-        int boxWidth = 150;
-        int boxHeight = 60;
-
-        // Fond semi-transparent avec bordure dorée
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-
-        // Bordure extérieure dorée (effet de surbrillance)
-        SDL_SetRenderDrawColor(renderer, 255, 215, 0, 200); // Or
-        SDL_Rect outerBorder = {boxX - 3, boxY - 3, boxWidth + 6, boxHeight + 6};
-        SDL_RenderFillRect(renderer, &outerBorder);
-
-        // Bordure moyenne plus foncée
-        SDL_SetRenderDrawColor(renderer, 180, 140, 0, 220);
-        SDL_Rect midBorder = {boxX - 2, boxY - 2, boxWidth + 4, boxHeight + 4};
-        SDL_RenderFillRect(renderer, &midBorder);
-
-        // Fond de la fenêtre
-        SDL_SetRenderDrawColor(renderer, 20, 20, 40, 230); // Bleu très foncé
-        SDL_Rect box = {boxX, boxY, boxWidth, boxHeight};
-        SDL_RenderFillRect(renderer, &box);
-
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-
-        // Texte "SCORE" en petit
-        SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
-        // Dessiner "SCORE" en pixels (5 lettres x 5 pixels de large + espaces)
-        int labelX = boxX + 10;
-        int labelY = boxY + 8;
-
-        // S
-        for (int py = 0; py < 7; py++) {
-            for (int px = 0; px < 5; px++) {
-                bool drawPixel = (py == 0 && px > 0) ||
-                               (px == 0 && py > 0 && py < 3) ||
-                               (py == 3 && px > 0 && px < 4) ||
-                               (px == 4 && py > 3 && py < 6) ||
-                               (py == 6 && px < 4);
-                if (drawPixel) {
-                    SDL_RenderDrawPoint(renderer, labelX + px, labelY + py);
-                }
-            }
-        }
-
-        // C
-        labelX += 7;
-        for (int py = 0; py < 7; py++) {
-            for (int px = 0; px < 5; px++) {
-                bool drawPixel = ((py == 0 || py == 6) && px > 0 && px < 5) ||
-                               (px == 0 && py > 0 && py < 6);
-                if (drawPixel) {
-                    SDL_RenderDrawPoint(renderer, labelX + px, labelY + py);
-                }
-            }
-        }
-
-        // O
-        labelX += 7;
-        for (int py = 0; py < 7; py++) {
-            for (int px = 0; px < 5; px++) {
-                bool drawPixel = ((py == 0 || py == 6) && px > 0 && px < 4) ||
-                               ((px == 0 || px == 4) && py > 0 && py < 6);
-                if (drawPixel) {
-                    SDL_RenderDrawPoint(renderer, labelX + px, labelY + py);
-                }
-            }
-        }
-
-        // R
-        labelX += 7;
-        for (int py = 0; py < 7; py++) {
-            for (int px = 0; px < 5; px++) {
-                bool drawPixel = (px == 0) ||
-                               (py == 0 && px < 4) ||
-                               (py == 3 && px < 4) ||
-                               (px == 4 && py > 0 && py < 3) ||
-                               (py > 3 && px == (py - 3));
-                if (drawPixel) {
-                    SDL_RenderDrawPoint(renderer, labelX + px, labelY + py);
-                }
-            }
-        }
-
-        // E
-        labelX += 7;
-        for (int py = 0; py < 7; py++) {
-            for (int px = 0; px < 5; px++) {
-                bool drawPixel = (px == 0) ||
-                               (py == 0 && px < 5) ||
-                               (py == 3 && px < 4) ||
-                               (py == 6 && px < 5);
-                if (drawPixel) {
-                    SDL_RenderDrawPoint(renderer, labelX + px, labelY + py);
-                }
-            }
-        }
-
-        // Afficher le score en grand et en jaune (aligné à gauche dans la boîte)
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
-        drawNumber(renderer, displayScore, boxX + 10, boxY + 28, 3);
-    }
-
-    // Écran de game over
-    if (gameOver) {
-        // Fond semi-transparent
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
-        SDL_Rect overlay = {0, 0, screenWidth, screenHeight};
-        SDL_RenderFillRect(renderer, &overlay);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-
-        // Texte "GAME OVER" centré (simplifié avec des rectangles)
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-        // On pourrait utiliser drawText ici mais pour simplifier on affiche juste le message
-
-        // Afficher le temps et le score total final au centre
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        int centerY = screenHeight / 2;
-        int finalTime = static_cast<int>(totalTime + elapsedTime);
-        drawNumber(renderer, finalTime, screenWidth / 2 - 50, centerY, 4);
-
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
-        int finalScore = totalScore + getScore();
-        drawNumber(renderer, finalScore, screenWidth / 2 - 80, centerY + 80, 4);
-    }
-}
-
-void Room::drawText(SDL_Renderer* renderer, const std::string& text, int x, int y, int size) {
-    // Fonction pour dessiner du texte pixel art
-    // Chaque caractère fait 8x8 pixels de base, multiplié par size
-
-    int charWidth = 8 * size;
-    int spacing = 2 * size;
-    int currentX = x;
-
-    for (char c : text) {
-        // Dessiner un rectangle pour chaque caractère
-        if (c != ' ') {
-            int pixelSize = size;
-
-            // Dessiner une forme de base pour chaque lettre
-            for (int py = 0; py < 7; py++) {
-                for (int px = 0; px < 5; px++) {
-                    bool drawPixel = false;
-
-                    // Patterns pour les lettres
-                    switch (c) {
-                        case 'A': case 'a':
-                            drawPixel = (py == 0 && px > 0 && px < 4) ||
-                                       (py > 0 && py < 7 && (px == 0 || px == 4)) ||
-                                       (py == 3 && px > 0 && px < 4);
-                            break;
-                        case 'E': case 'e':
-                            drawPixel = (px == 0) ||
-                                       (py == 0) ||
-                                       (py == 3 && px < 4) ||
-                                       (py == 6);
-                            break;
-                        case 'I': case 'i':
-                            drawPixel = (px == 2) ||
-                                       (py == 0) ||
-                                       (py == 6);
-                            break;
-                        case 'J': case 'j':
-                            drawPixel = (py == 0) ||
-                                       (px == 3 && py < 6) ||
-                                       (py == 6 && px < 4) ||
-                                       (px == 0 && py == 5);
-                            break;
-                        case 'L': case 'l':
-                            drawPixel = (px == 0) ||
-                                       (py == 6);
-                            break;
-                        case 'N': case 'n':
-                            drawPixel = (px == 0) ||
-                                       (px == 4) ||
-                                       (py == px && px < 5);
-                            break;
-                        case 'O': case 'o':
-                            drawPixel = (py == 0 && px > 0 && px < 4) ||
-                                       (py == 6 && px > 0 && px < 4) ||
-                                       ((px == 0 || px == 4) && py > 0 && py < 6);
-                            break;
-                        case 'R': case 'r':
-                            drawPixel = (px == 0) ||
-                                       (py == 0 && px < 4) ||
-                                       (py == 3 && px < 4) ||
-                                       (px == 4 && py > 0 && py < 3) ||
-                                       (py - 3 == px && px > 0);
-                            break;
-                        case 'S': case 's':
-                            drawPixel = (py == 0 && px > 0) ||
-                                       (px == 0 && py > 0 && py < 3) ||
-                                       (py == 3 && px > 0 && px < 4) ||
-                                       (px == 4 && py > 3 && py < 6) ||
-                                       (py == 6 && px < 4);
-                            break;
-                        case 'T': case 't':
-                            drawPixel = (py == 0) ||
-                                       (px == 2);
-                            break;
-                        case 'U': case 'u':
-                            drawPixel = ((px == 0 || px == 4) && py < 6) ||
-                                       (py == 6 && px > 0 && px < 4);
-                            break;
-                        case 'C': case 'c':
-                            drawPixel = (py == 0 && px > 0) ||
-                                       (py == 6 && px > 0) ||
-                                       (px == 0 && py > 0 && py < 6);
-                            break;
-                        case 'D': case 'd':
-                            drawPixel = (px == 0) ||
-                                       (py == 0 && px < 4) ||
-                                       (py == 6 && px < 4) ||
-                                       (px == 4 && py > 0 && py < 6);
-                            break;
-                        case '\'':
-                            drawPixel = (px == 2 && py < 2);
-                            break;
-                        default:
-                            // Pour les caractères non définis, dessiner un bloc simple
-                            drawPixel = (px == 2 && py > 1 && py < 5);
-                            break;
-                    }
-
-                    if (drawPixel) {
-                        for (int sy = 0; sy < pixelSize; sy++) {
-                            for (int sx = 0; sx < pixelSize; sx++) {
-                                SDL_RenderDrawPoint(renderer,
-                                                  currentX + px * pixelSize + sx,
-                                                  y + py * pixelSize + sy);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        currentX += charWidth + spacing;
-    }
+bool Room::isPlayerInHole(const Vector2D& playerPos, int playerRadius) const {
+    // Le centre du joueur est dans un trou réduit de la moitié de son rayon
+    // (cercle de rayon négatif). Appelé à chaque pas des vérifications de
+    // chemin des ennemis : tous les trous sont testés par lots.
+    float playerRadiusOffset = playerRadius / 2.0f;
+    int hole;
+    return VectorBatch::overlapCircle(playerPos.x, playerPos.y, -playerRadiusOffset,
+                                      holeX.data(), holeY.data(), holeRadii.data(),
+                                      static_cast<int>(holes.size()), &hole, 1) > 0;
 }
 
-bool Room::isPlayerInHole(const Vector2D& playerPos, int playerRadius) const {
-    // Optimisé : comparer les carrés des distances pour éviter sqrt()
+bool Room::sweepHoles(const Vector2D& from, const Vector2D& to, int playerRadius, float& t) const {
+    // Même rayon effectif que isPlayerInHole
     float playerRadiusOffset = playerRadius / 2.0f;
+    bool hit = false;
 
     for (const auto& hole : holes) {
-        float dx = playerPos.x - hole.position.x;
-        float dy = playerPos.y - hole.position.y;
-        float distanceSq = dx * dx + dy * dy;
-        float maxDistSq = (hole.radius - playerRadiusOffset) * (hole.radius - playerRadiusOffset);
-
-        // Si le centre du joueur est dans le trou (comparaison sans sqrt)
-        if (distanceSq <= maxDistSq) {
-            return true;
+        float holeT;
+        if (Collision::sweepCircle(from, to, hole.position, hole.radius - playerRadiusOffset, holeT) &&
+            (!hit || holeT < t)) {
+            t = holeT;
+            hit = true;
         }
     }
-    return false;
+    return hit;
 }
 
 bool Room::hasReachedEnd(const Vector2D& playerPos) const {
@@ -847,105 +263,56 @@ bool Room::hasReachedEnd(const Vector2D& playerPos) const {
     return playerPos.x >= endZoneX;
 }
 
-bool Room::isPlayerTouchingElectricStar(const Vector2D& playerPos, int playerRadius) const {
-    // Optimisé : comparer les carrés des distances pour éviter sqrt()
-    float collisionDistSq = (playerRadius + electricStarRadius) * (playerRadius + electricStarRadius);
-
-    // Vérifier la collision avec l'étoile électrique centrale
-    float dx = playerPos.x - electricStarPos.x;
-    float dy = playerPos.y - electricStarPos.y;
-    float distanceSq = dx * dx + dy * dy;
+bool Room::saveState(RoomSnapshot& snapshot) const {
+    static_assert(CELEBRATION_PARTICLES <= SnapshotLimits::MAX_PARTICLES,
+                  "L'instantané doit contenir toutes les particules d'une célébration");
 
-    if (distanceSq < collisionDistSq) {
-        return true;
+    if (holes.size() > static_cast<size_t>(SnapshotLimits::MAX_HOLES) ||
+        particles.size() > static_cast<size_t>(SnapshotLimits::MAX_PARTICLES)) {
+        return false;
     }
 
-    // En mode difficile, vérifier aussi la collision avec l'étoile satellite
-    if (difficulty == Difficulty::HARD) {
-        float dxSat = playerPos.x - satelliteStarPos.x;
-        float dySat = playerPos.y - satelliteStarPos.y;
-        float distanceSatSq = dxSat * dxSat + dySat * dySat;
-
-        if (distanceSatSq < collisionDistSq) {
-            return true;
-        }
-    }
-
-    return false;
+    holeRandom.getState(snapshot.holeRandom.state);
+    particleRandom.getState(snapshot.particleRandom.state);
+    snapshot.level = level;
+    snapshot.difficulty = static_cast<int32_t>(difficulty);
+    snapshot.holeCount = static_cast<int32_t>(holes.size());
+    snapshot.particleCount = static_cast<int32_t>(particles.size());
+    snapshot.elapsedTime = elapsedTime;
+    snapshot.celebrationTime = celebrationTime;
+    snapshot.arrowAnimPhase = arrowAnimPhase;
+    snapshot.electricAnimPhase = electricAnimPhase;
+    snapshot.satelliteHazard = satelliteHazard;
+    hazards.saveState(snapshot.hazards);
+    snapshot.timerRunning = timerRunning;
+    snapshot.celebrating = celebrating;
+    std::copy(holes.begin(), holes.end(), snapshot.holes);
+    std::copy(particles.begin(), particles.end(), snapshot.particles);
+    return true;
 }
 
-void Room::drawElectricStar(SDL_Renderer* renderer) {
-    int centerX = static_cast<int>(electricStarPos.x);
-    int centerY = static_cast<int>(electricStarPos.y);
-
-    // Couleur électrique jaune
-    float pulse = 0.7f + 0.3f * std::sin(electricAnimPhase);
-
-    // Dessiner le noyau central (cercle lumineux) - Optimisé avec lignes horizontales
-    int radiusSq = electricStarRadius * electricStarRadius;
-    for (int y = -electricStarRadius; y <= electricStarRadius; y++) {
-        int halfWidth = static_cast<int>(std::sqrt(radiusSq - y * y));
-        int alpha = static_cast<int>(200 * pulse * (1.0f - std::sqrt(y * y + halfWidth * halfWidth * 0.5f) / electricStarRadius));
-        SDL_SetRenderDrawColor(renderer, 255, 220, 50, alpha);
-        SDL_RenderDrawLine(renderer,
-                         centerX - halfWidth, centerY + y,
-                         centerX + halfWidth, centerY + y);
-    }
-
-    // Dessiner les éclairs (8 branches) - Optimisé avec moins d'itérations
-    for (size_t i = 0; i < boltAngles.size(); i++) {
-        float angle = boltAngles[i] + electricAnimPhase * 0.5f;
-        float boltLength = electricStarRadius * 2.5f + std::sin(electricAnimPhase * 2.0f + i) * 5.0f;
-
-        // Éclair principal - simplifié avec moins d'itérations
-        int prevX = centerX + static_cast<int>(std::cos(angle) * electricStarRadius);
-        int prevY = centerY + static_cast<int>(std::sin(angle) * electricStarRadius);
-
-        for (float len = electricStarRadius; len < boltLength; len += 2.0f) {  // Pas de 2 au lieu de 1
-            int x = centerX + static_cast<int>(std::cos(angle) * len);
-            int y = centerY + static_cast<int>(std::sin(angle) * len);
-
-            // Zigzag simplifié
-            float zigzag = std::sin(len * 0.5f + electricAnimPhase * 3.0f) * 2.0f;
-            x += static_cast<int>(std::cos(angle + M_PI / 2) * zigzag);
-            y += static_cast<int>(std::sin(angle + M_PI / 2) * zigzag);
-
-            float alpha = 255 * (1.0f - (len - electricStarRadius) / (boltLength - electricStarRadius)) * pulse;
-            SDL_SetRenderDrawColor(renderer, 255, 240, 100, static_cast<Uint8>(alpha));
-
-            // Dessiner une ligne au lieu de 3 points
-            SDL_RenderDrawLine(renderer, prevX, prevY, x, y);
-            prevX = x;
-            prevY = y;
-        }
-
-        // Branches secondaires - réduites (seulement 4 au lieu de 8)
-        if (i % 2 == 0) {
-            float branchAngle = angle + M_PI / 4;
-            float branchStart = boltLength * 0.6f;
-            float branchLength = boltLength * 0.4f;
-
-            int startX = centerX + static_cast<int>(std::cos(angle) * branchStart);
-            int startY = centerY + static_cast<int>(std::sin(angle) * branchStart);
-            int endX = startX + static_cast<int>(std::cos(branchAngle) * branchLength);
-            int endY = startY + static_cast<int>(std::sin(branchAngle) * branchLength);
-
-            SDL_SetRenderDrawColor(renderer, 255, 230, 80, static_cast<Uint8>(150 * pulse));
-            SDL_RenderDrawLine(renderer, startX, startY, endX, endY);
-        }
-    }
-
-    // Aura externe - drastiquement simplifiée, seulement 3 cercles au lieu de plusieurs
-    for (int r = electricStarRadius * 2; r < electricStarRadius * 3; r += electricStarRadius / 3) {
-        float alpha = 30 * pulse * (1.0f - static_cast<float>(r - electricStarRadius * 2) / static_cast<float>(electricStarRadius));
-        SDL_SetRenderDrawColor(renderer, 255, 220, 50, static_cast<Uint8>(alpha));
-
-        // Dessiner seulement 12 points (tous les 30°) au lieu de 36 (tous les 10°)
-        for (int angle = 0; angle < 360; angle += 30) {
-            float rad = angle * M_PI / 180.0f;
-            int x = centerX + static_cast<int>(std::cos(rad) * r);
-            int y = centerY + static_cast<int>(std::sin(rad) * r);
-            SDL_RenderDrawPoint(renderer, x, y);
-        }
+void Room::loadState(const RoomSnapshot& snapshot) {
+    holeRandom.setState(snapshot.holeRandom.state);
+    particleRandom.setState(snapshot.particleRandom.state);
+    level = snapshot.level;
+    difficulty = static_cast<Difficulty>(snapshot.difficulty);
+    elapsedTime = snapshot.elapsedTime;
+    celebrationTime = snapshot.celebrationTime;
+    arrowAnimPhase = snapshot.arrowAnimPhase;
+    electricAnimPhase = snapshot.electricAnimPhase;
+    satelliteHazard = snapshot.satelliteHazard;
+    // Tableaux déjà vérifiés par validateSnapshot
+    hazards.loadState(snapshot.hazards);
+    timerRunning = snapshot.timerRunning != 0;
+    celebrating = snapshot.celebrating != 0;
+
+    // clear() garde la capacité réservée à la construction
+    holes.clear();
+    holeX.clear();
+    holeY.clear();
+    holeRadii.clear();
+    for (int i = 0; i < snapshot.holeCount; i++) {
+        addHole(snapshot.holes[i].position, snapshot.holes[i].radius);
     }
+    particles.assign(snapshot.particles, snapshot.particles + snapshot.particleCount);
 }
@@ -0,0 +1,93 @@
+#include "RoomBuilder.hpp"
+#include "Room.hpp"
+
+RoomBuilder::RoomBuilder()
+    : pendingRoom(nullptr),
+      pendingLevel(1),
+      pendingDifficulty(Difficulty::MEDIUM),
+      pendingSeed(0),
+      busy(false),
+      stopping(false) {}
+
+RoomBuilder::~RoomBuilder() {
+    stop();
+}
+
+void RoomBuilder::start() {
+    if (worker.joinable()) {
+        return;
+    }
+    stopping = false;
+    worker = std::thread(&RoomBuilder::run, this);
+}
+
+void RoomBuilder::stop() {
+    if (!worker.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWorker.notify_one();
+    worker.join();
+}
+
+void RoomBuilder::request(Room* room, int level, Difficulty difficulty, uint64_t runSeed) {
+    // Une seule préparation à la fois
+    wait();
+
+    if (!worker.joinable()) {
+        // Pas de thread de travail : préparation synchrone
+        room->reset(level, difficulty, runSeed);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingRoom = room;
+        pendingLevel = level;
+        pendingDifficulty = difficulty;
+        pendingSeed = runSeed;
+        busy = true;
+    }
+    wakeWorker.notify_one();
+}
+
+void RoomBuilder::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [this] { return !busy; });
+}
+
+bool RoomBuilder::isBusy() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return busy;
+}
+
+void RoomBuilder::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wakeWorker.wait(lock, [this] { return stopping || pendingRoom != nullptr; });
+        if (stopping) {
+            busy = false;
+            jobDone.notify_all();
+            return;
+        }
+
+        Room* room = pendingRoom;
+        int level = pendingLevel;
+        Difficulty difficulty = pendingDifficulty;
+        uint64_t runSeed = pendingSeed;
+        pendingRoom = nullptr;
+
+        // Génération hors verrou : le thread principal continue de jouer
+        lock.unlock();
+        room->reset(level, difficulty, runSeed);
+        lock.lock();
+
+        busy = false;
+        jobDone.notify_all();
+    }
+}
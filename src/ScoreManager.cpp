@@ -16,6 +16,26 @@ ScoreManager& ScoreManager::getInstance() {
     return instance;
 }
 
+void ScoreManager::addListener(ScoreListener listener, void* context) {
+    ListenerEntry entry = {listener, context};
+    listeners.push_back(entry);
+}
+
+void ScoreManager::removeListener(ScoreListener listener, void* context) {
+    for (size_t i = 0; i < listeners.size(); i++) {
+        if (listeners[i].listener == listener && listeners[i].context == context) {
+            listeners.erase(listeners.begin() + i);
+            return;
+        }
+    }
+}
+
+void ScoreManager::notifyListeners() {
+    for (const ListenerEntry& entry : listeners) {
+        entry.listener(entry.context);
+    }
+}
+
 std::string ScoreManager::getScoreFilePath() const {
     // Sauvegarder dans le répertoire courant
     return SCORE_FILE;
@@ -29,6 +49,7 @@ bool ScoreManager::loadHighScore() {
         highScoreEasy = 0;
         highScoreMedium = 0;
         highScoreHard = 0;
+        notifyListeners();
         return false;
     }
 
@@ -40,6 +61,7 @@ bool ScoreManager::loadHighScore() {
     if (highScoreMedium < 0) highScoreMedium = 0;
     if (highScoreHard < 0) highScoreHard = 0;
 
+    notifyListeners();
     return true;
 }
 
@@ -61,6 +83,7 @@ void ScoreManager::saveHighScore(int score, Difficulty difficulty) {
     // Ne sauvegarder que si c'est un nouveau record pour cette difficulté
     if (targetScore && score > *targetScore) {
         *targetScore = score;
+        notifyListeners();
 
         std::ofstream file(getScoreFilePath());
 
@@ -86,3 +109,39 @@ int ScoreManager::getHighScore(Difficulty difficulty) const {
             return 0;
     }
 }
+
+bool ScoreManager::saveRecords(const std::string& path, const std::vector<ScoreRecord>& records) {
+    std::ofstream file(path);
+
+    if (!file.is_open()) {
+        std::cerr << "Erreur: Impossible d'écrire les scores dans " << path << std::endl;
+        return false;
+    }
+
+    for (const auto& record : records) {
+        file << record.score << " " << static_cast<int>(record.difficulty) << "\n";
+    }
+    return true;
+}
+
+bool ScoreManager::loadRecords(const std::string& path, std::vector<ScoreRecord>& records) {
+    records.clear();
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    int score = 0;
+    int difficulty = 0;
+    while (file >> score >> difficulty) {
+        if (difficulty < static_cast<int>(Difficulty::EASY) || difficulty > static_cast<int>(Difficulty::HARD)) {
+            return false;
+        }
+        ScoreRecord record;
+        record.score = score;
+        record.difficulty = static_cast<Difficulty>(difficulty);
+        records.push_back(record);
+    }
+    return file.eof();
+}
@@ -0,0 +1,130 @@
+#include "Simulation.hpp"
+#include <chrono>
+#include <random>
+
+Simulation::Simulation(int width, int height)
+    : world(width, height),
+      gameStarted(false),
+      hasQuickSave(false),
+      rewindBuffer(sizeof(WorldSnapshot), REWIND_SECONDS * 60, REWIND_KEYFRAME_INTERVAL, REWIND_BUDGET),
+      seed(0),
+      fixedSeed(false) {}
+
+Simulation::~Simulation() {}
+
+void Simulation::setSeed(uint64_t newSeed) {
+    seed = newSeed;
+    fixedSeed = true;
+}
+
+uint64_t Simulation::makeRunSeed() {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device() ^
+           static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+bool Simulation::restoreQuickSave(const WorldSnapshot& snapshot) {
+    if (!validateSnapshot(snapshot)) {
+        return false;
+    }
+    quickSave = snapshot;
+    hasQuickSave = true;
+    return true;
+}
+
+void Simulation::processEvents(const InputFrame& input, SimulationEvents& events) {
+    for (int i = 0; i < input.eventCount; i++) {
+        SDL_Event event = {};
+        event.type = input.events[i].type;
+        event.key.keysym.sym = input.events[i].key;
+        processEvent(event, events);
+    }
+}
+
+void Simulation::processEvent(SDL_Event& event, SimulationEvents& events) {
+    if (!gameStarted) {
+        // Gérer les entrées du menu
+        menu.handleInput(event);
+
+        // Vérifier si le jeu doit démarrer
+        if (menu.shouldStartNewGame()) {
+            gameStarted = true;
+            menu.resetFlags();
+
+            // Nouvelle graine de partie, sauf si elle est fixée
+            world.start(menu.getDifficulty(), 1, fixedSeed ? seed : makeRunSeed());
+            rewindBuffer.clear();
+            events.newGame = true;
+        } else if (menu.shouldContinueGame()) {
+            gameStarted = true;
+            menu.resetFlags();
+            // Continuer avec l'état actuel du jeu
+        } else if (menu.shouldQuit()) {
+            events.quit = true;
+        }
+        return;
+    }
+
+    // Gérer les entrées du jeu
+    if (event.type != SDL_KEYDOWN) {
+        return;
+    }
+
+    SDL_Keycode key = event.key.keysym.sym;
+
+    // Saut avec W ou Espace
+    if ((key == SDLK_w || key == SDLK_SPACE) && world.jump()) {
+        events.jumped = true;
+    }
+
+    // Attaque avec Shift
+    if (key == SDLK_LSHIFT && world.attack()) {
+        events.attacked = true;
+    }
+
+    // Sauvegarde et chargement rapides
+    if (key == SDLK_F5 && !world.isGameOver() && world.saveState(quickSave)) {
+        hasQuickSave = true;
+        events.stateSaved = true;
+    }
+    if (key == SDLK_F9 && hasQuickSave && !world.isGameOver() && world.loadState(quickSave)) {
+        events.stateLoaded = true;
+    }
+
+    if (key == SDLK_ESCAPE) {
+        // Retour au menu
+        gameStarted = false;
+        menu.setState(MenuState::MAIN_MENU);
+        menu.resetToMainMenu();
+        events.backToMenu = true;
+    }
+}
+
+void Simulation::update(const InputFrame& input, SimulationEvents& events) {
+    if (!gameStarted) {
+        // Mettre à jour le menu
+        menu.update();
+        return;
+    }
+
+    // Retour en arrière : une frame de l'historique par frame de jeu
+    if ((input.heldKeys & InputKeys::REWIND) && !world.isGameOver()) {
+        if (rewindBuffer.stepBack(&rewindFrame) && world.loadState(rewindFrame)) {
+            events.rewinding = true;
+        }
+        return;
+    }
+
+    WorldEvents worldEvents;
+    worldEvents.clear();
+    world.update(input.heldKeys, worldEvents);
+
+    if (worldEvents.gameOver) {
+        events.gameOver = true;
+        events.finalScore = worldEvents.finalScore;
+    }
+
+    if (world.isInRoom() && world.saveState(rewindFrame)) {
+        rewindBuffer.push(&rewindFrame);
+    }
+}
@@ -0,0 +1,92 @@
+#include "Snapshot.hpp"
+#include "Player.hpp"
+#include "Enemy.hpp"
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+bool inRange(int32_t value, int32_t low, int32_t high) {
+    return value >= low && value <= high;
+}
+
+bool validDifficulty(int32_t difficulty) {
+    return inRange(difficulty, static_cast<int32_t>(Difficulty::EASY), static_cast<int32_t>(Difficulty::HARD));
+}
+
+bool validPlayer(const PlayerSnapshot& player) {
+    return inRange(player.direction, static_cast<int32_t>(Direction::DOWN), static_cast<int32_t>(Direction::UP_RIGHT)) &&
+           inRange(player.historyHead, 0, SnapshotLimits::PLAYER_HISTORY - 1);
+}
+
+bool validRoom(const RoomSnapshot& room) {
+    return room.level >= 1 &&
+           validDifficulty(room.difficulty) &&
+           inRange(room.holeCount, 0, SnapshotLimits::MAX_HOLES) &&
+           inRange(room.particleCount, 0, SnapshotLimits::MAX_PARTICLES) &&
+           HazardSystem::isValid(room.hazards) &&
+           inRange(room.satelliteHazard, -1, room.hazards.count - 1);
+}
+
+} // namespace
+
+bool validateSnapshot(const WorldSnapshot& snapshot) {
+    if (snapshot.magic != WorldSnapshot::MAGIC || snapshot.version != WorldSnapshot::VERSION) {
+        return false;
+    }
+    if (!validDifficulty(snapshot.difficulty) || snapshot.currentLevel < 1 ||
+        !inRange(snapshot.enemyCount, 0, SnapshotLimits::MAX_ENEMIES)) {
+        return false;
+    }
+    if (!validPlayer(snapshot.player) || snapshot.aiTick < 0) {
+        return false;
+    }
+    for (int i = 0; i < snapshot.enemyCount; i++) {
+        if (!Enemy::isValid(snapshot.enemies[i], snapshot.aiTick)) {
+            return false;
+        }
+    }
+    // La salle n'est lue que si elle existe
+    return !snapshot.hasRoom || validRoom(snapshot.room);
+}
+
+bool writeSnapshotFile(const char* path, const WorldSnapshot& snapshot) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Erreur: Impossible de créer la sauvegarde " << path << std::endl;
+        return false;
+    }
+
+    uint32_t size = sizeof(WorldSnapshot);
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(&snapshot), sizeof(WorldSnapshot));
+
+    if (!file) {
+        std::cerr << "Erreur: Écriture incomplète de la sauvegarde " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool readSnapshotFile(const char* path, WorldSnapshot& snapshot) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erreur: Impossible d'ouvrir la sauvegarde " << path << std::endl;
+        return false;
+    }
+
+    // Une taille différente signale une sauvegarde d'une autre version du jeu
+    uint32_t size = 0;
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!file || size != sizeof(WorldSnapshot)) {
+        std::cerr << "Erreur: Sauvegarde incompatible " << path << std::endl;
+        return false;
+    }
+
+    file.read(reinterpret_cast<char*>(&snapshot), sizeof(WorldSnapshot));
+    if (!file || !validateSnapshot(snapshot)) {
+        std::cerr << "Erreur: Sauvegarde invalide " << path << std::endl;
+        return false;
+    }
+    return true;
+}
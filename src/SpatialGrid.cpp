@@ -0,0 +1,118 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+
+SpatialGrid::SpatialGrid(float width, float height, float cellSize, int maxObjects, float maxRadius)
+    : cellSize(cellSize),
+      inverseCellSize(1.0f / cellSize),
+      columns(static_cast<int>(width / cellSize) + 1),
+      rows(static_cast<int>(height / cellSize) + 1),
+      currentStamp(0) {
+
+    cellStart.assign(columns * rows + 1, 0);
+    cellCursor.assign(columns * rows, 0);
+
+    // Une boîte de côté 2 * maxRadius chevauche au plus span cellules par
+    // axe (bornées par la grille : les positions sont ramenées au bord)
+    int span = static_cast<int>(2.0f * maxRadius * inverseCellSize) + 2;
+    int cellsPerObject = std::min(span, columns) * std::min(span, rows);
+    boxes.assign(maxObjects * 4, 0);
+    stamps.assign(maxObjects, 0);
+    items.assign(maxObjects * cellsPerObject, 0);
+}
+
+SpatialGrid::~SpatialGrid() {}
+
+int SpatialGrid::cellX(float x) const {
+    int cell = static_cast<int>(x * inverseCellSize);
+    return std::max(0, std::min(columns - 1, cell));
+}
+
+int SpatialGrid::cellY(float y) const {
+    int cell = static_cast<int>(y * inverseCellSize);
+    return std::max(0, std::min(rows - 1, cell));
+}
+
+void SpatialGrid::build(int count, const float* x, const float* y, const float* radius) {
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    if (static_cast<int>(boxes.size()) < count * 4) {
+        boxes.resize(count * 4);
+    }
+    if (static_cast<int>(stamps.size()) < count) {
+        stamps.resize(count, 0);
+    }
+
+    // Première passe : nombre d'objets par cellule
+    int total = 0;
+    for (int i = 0; i < count; i++) {
+        int16_t* box = &boxes[i * 4];
+        box[0] = static_cast<int16_t>(cellX(x[i] - radius[i]));
+        box[1] = static_cast<int16_t>(cellY(y[i] - radius[i]));
+        box[2] = static_cast<int16_t>(cellX(x[i] + radius[i]));
+        box[3] = static_cast<int16_t>(cellY(y[i] + radius[i]));
+
+        for (int cy = box[1]; cy <= box[3]; cy++) {
+            for (int cx = box[0]; cx <= box[2]; cx++) {
+                cellStart[cy * columns + cx + 1]++;
+            }
+        }
+        total += (box[2] - box[0] + 1) * (box[3] - box[1] + 1);
+    }
+
+    // Sommes cumulées : cellStart[c] = début de la cellule c
+    for (int c = 0; c < columns * rows; c++) {
+        cellStart[c + 1] += cellStart[c];
+    }
+    if (static_cast<int>(items.size()) < total) {
+        items.resize(total);
+    }
+
+    // Seconde passe : indices rangés par ordre croissant dans chaque cellule
+    std::copy(cellStart.begin(), cellStart.end() - 1, cellCursor.begin());
+    for (int i = 0; i < count; i++) {
+        const int16_t* box = &boxes[i * 4];
+        for (int cy = box[1]; cy <= box[3]; cy++) {
+            for (int cx = box[0]; cx <= box[2]; cx++) {
+                items[cellCursor[cy * columns + cx]++] = i;
+            }
+        }
+    }
+}
+
+int SpatialGrid::query(float minX, float minY, float maxX, float maxY, int* out, int maxOut) const {
+    int found = queryUnsorted(minX, minY, maxX, maxY, out, maxOut);
+
+    // Ordre déterministe, indépendant du découpage en cellules
+    std::sort(out, out + found);
+    return found;
+}
+
+int SpatialGrid::queryUnsorted(float minX, float minY, float maxX, float maxY, int* out, int maxOut) const {
+    int x0 = cellX(minX);
+    int y0 = cellY(minY);
+    int x1 = cellX(maxX);
+    int y1 = cellY(maxY);
+
+    // Un objet couvrant plusieurs cellules n'est rendu qu'une fois
+    currentStamp++;
+    if (currentStamp == 0) {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        currentStamp = 1;
+    }
+
+    int found = 0;
+    for (int cy = y0; cy <= y1; cy++) {
+        for (int cx = x0; cx <= x1; cx++) {
+            int cell = cy * columns + cx;
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+                int index = items[k];
+                if (stamps[index] == currentStamp) continue;
+                stamps[index] = currentStamp;
+                if (found < maxOut) {
+                    out[found++] = index;
+                }
+            }
+        }
+    }
+
+    return found;
+}
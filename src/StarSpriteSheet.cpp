@@ -0,0 +1,199 @@
+#include "StarSpriteSheet.hpp"
+#include "FastMath.hpp"
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+const int BOLT_COUNT = 8;
+
+// Demi-côté d'une case : l'aura s'arrête avant 3 rayons, un éclair avant
+// 2.5 rayons + 5 (plus 2 de zigzag), une branche au bout de son éclair
+int sheetExtent(int radius) {
+    return std::max(3 * radius, (5 * radius) / 2 + 8) + 1;
+}
+
+} // namespace
+
+StarSpriteSheet::StarSpriteSheet() {}
+
+StarSpriteSheet::~StarSpriteSheet() {
+    cleanup();
+}
+
+StarSpriteSheet& StarSpriteSheet::getInstance() {
+    static StarSpriteSheet instance;
+    return instance;
+}
+
+void StarSpriteSheet::cleanup() {
+    for (auto& entry : sheets) {
+        if (entry.second.texture) {
+            SDL_DestroyTexture(entry.second.texture);
+        }
+    }
+    sheets.clear();
+}
+
+void StarSpriteSheet::draw(SDL_Renderer* renderer, int centerX, int centerY, int radius, float phase) {
+    auto it = sheets.find(radius);
+    if (it == sheets.end()) {
+        it = sheets.emplace(radius, buildSheet(renderer, radius)).first;
+    }
+
+    const Sheet& sheet = it->second;
+    if (!sheet.texture) {
+        drawStar(renderer, centerX, centerY, radius, phase);
+        return;
+    }
+
+    // Phase la plus proche parmi les FRAME_COUNT de la planche
+    int frame = static_cast<int>(phase / (2.0f * static_cast<float>(M_PI)) * StarSheetLayout::FRAME_COUNT + 0.5f);
+    frame = ((frame % StarSheetLayout::FRAME_COUNT) + StarSheetLayout::FRAME_COUNT) % StarSheetLayout::FRAME_COUNT;
+
+    int extent = sheetExtent(radius);
+    SDL_Rect source = {(frame % StarSheetLayout::COLUMNS) * sheet.cellSize,
+                       (frame / StarSheetLayout::COLUMNS) * sheet.cellSize,
+                       sheet.cellSize, sheet.cellSize};
+    SDL_Rect destination = {centerX - extent, centerY - extent, sheet.cellSize, sheet.cellSize};
+    SDL_RenderCopy(renderer, sheet.texture, &source, &destination);
+}
+
+StarSpriteSheet::Sheet StarSpriteSheet::buildSheet(SDL_Renderer* renderer, int radius) {
+    Sheet sheet = {nullptr, 2 * sheetExtent(radius) + 1};
+    int extent = sheetExtent(radius);
+    int rows = (StarSheetLayout::FRAME_COUNT + StarSheetLayout::COLUMNS - 1) / StarSheetLayout::COLUMNS;
+
+    // Tracé sur une surface en mémoire avec le renderer logiciel : pas besoin
+    // que le renderer de la fenêtre accepte les textures cibles
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, StarSheetLayout::COLUMNS * sheet.cellSize,
+                                                          rows * sheet.cellSize, 32, SDL_PIXELFORMAT_RGBA8888);
+    if (!surface) {
+        std::cerr << "Erreur SDL_CreateRGBSurfaceWithFormat: " << SDL_GetError() << std::endl;
+        return sheet;
+    }
+    SDL_Renderer* software = SDL_CreateSoftwareRenderer(surface);
+    if (!software) {
+        std::cerr << "Erreur SDL_CreateSoftwareRenderer: " << SDL_GetError() << std::endl;
+        SDL_FreeSurface(surface);
+        return sheet;
+    }
+
+    SDL_SetRenderDrawColor(software, 0, 0, 0, 0);
+    SDL_RenderClear(software);
+    for (int frame = 0; frame < StarSheetLayout::FRAME_COUNT; frame++) {
+        SDL_Rect cell = {(frame % StarSheetLayout::COLUMNS) * sheet.cellSize,
+                         (frame / StarSheetLayout::COLUMNS) * sheet.cellSize,
+                         sheet.cellSize, sheet.cellSize};
+        SDL_RenderSetClipRect(software, &cell);
+        float phase = 2.0f * static_cast<float>(M_PI) * frame / StarSheetLayout::FRAME_COUNT;
+        drawStar(software, cell.x + extent, cell.y + extent, radius, phase);
+    }
+    SDL_RenderPresent(software);  // Vide la file de tracé vers la surface
+    SDL_DestroyRenderer(software);
+
+    // L'étoile est tracée sans mélange : chaque pixel touché remplace le
+    // fond. Ces pixels deviennent opaques (toutes les couleurs de l'étoile
+    // ont un rouge non nul), le reste de la case reste transparent.
+    if (SDL_LockSurface(surface) == 0) {
+        for (int y = 0; y < surface->h; y++) {
+            Uint32* row = reinterpret_cast<Uint32*>(static_cast<Uint8*>(surface->pixels) + y * surface->pitch);
+            for (int x = 0; x < surface->w; x++) {
+                if ((row[x] >> 24) != 0) {
+                    row[x] |= 0xFF;
+                }
+            }
+        }
+        SDL_UnlockSurface(surface);
+    }
+
+    sheet.texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (!sheet.texture) {
+        std::cerr << "Erreur SDL_CreateTextureFromSurface: " << SDL_GetError() << std::endl;
+        return sheet;
+    }
+    SDL_SetTextureBlendMode(sheet.texture, SDL_BLENDMODE_BLEND);
+    return sheet;
+}
+
+void StarSpriteSheet::drawStar(SDL_Renderer* renderer, int centerX, int centerY, int radius, float phase) {
+
+    // Couleur électrique jaune
+    float pulse = 0.7f + 0.3f * FastMath::sin(phase);
+
+    // Dessiner le noyau central (cercle lumineux) - Optimisé avec lignes horizontales
+    int radiusSq = radius * radius;
+    for (int y = -radius; y <= radius; y++) {
+        int halfWidth = static_cast<int>(std::sqrt(radiusSq - y * y));
+        int alpha = static_cast<int>(200 * pulse * (1.0f - FastMath::sqrt(y * y + halfWidth * halfWidth * 0.5f) / radius));
+        SDL_SetRenderDrawColor(renderer, 255, 220, 50, alpha);
+        SDL_RenderDrawLine(renderer,
+                         centerX - halfWidth, centerY + y,
+                         centerX + halfWidth, centerY + y);
+    }
+
+    // Dessiner les éclairs (8 branches, tous les 45°) - Optimisé avec moins d'itérations
+    for (int i = 0; i < BOLT_COUNT; i++) {
+        // Direction de l'éclair calculée une fois : la perpendiculaire du
+        // zigzag est (-sin, cos)
+        float boltAngle = static_cast<float>((i * 45.0f) * M_PI / 180.0f);
+        uint32_t angle = FastMath::radiansToPhase(boltAngle + phase * 0.5f);
+        float directionX = FastMath::cosPhase(angle);
+        float directionY = FastMath::sinPhase(angle);
+        float boltLength = radius * 2.5f + FastMath::sin(phase * 2.0f + i) * 5.0f;
+
+        // Éclair principal - simplifié avec moins d'itérations
+        int prevX = centerX + static_cast<int>(directionX * radius);
+        int prevY = centerY + static_cast<int>(directionY * radius);
+
+        for (float len = radius; len < boltLength; len += 2.0f) {  // Pas de 2 au lieu de 1
+            int x = centerX + static_cast<int>(directionX * len);
+            int y = centerY + static_cast<int>(directionY * len);
+
+            // Zigzag simplifié
+            float zigzag = FastMath::sin(len * 0.5f + phase * 3.0f) * 2.0f;
+            x += static_cast<int>(-directionY * zigzag);
+            y += static_cast<int>(directionX * zigzag);
+
+            float alpha = 255 * (1.0f - (len - radius) / (boltLength - radius)) * pulse;
+            SDL_SetRenderDrawColor(renderer, 255, 240, 100, static_cast<Uint8>(alpha));
+
+            // Dessiner une ligne au lieu de 3 points
+            SDL_RenderDrawLine(renderer, prevX, prevY, x, y);
+            prevX = x;
+            prevY = y;
+        }
+
+        // Branches secondaires - réduites (seulement 4 au lieu de 8)
+        if (i % 2 == 0) {
+            uint32_t branchAngle = angle + FastMath::QUARTER_TURN / 2;  // +45°
+            float branchStart = boltLength * 0.6f;
+            float branchLength = boltLength * 0.4f;
+
+            int startX = centerX + static_cast<int>(directionX * branchStart);
+            int startY = centerY + static_cast<int>(directionY * branchStart);
+            int endX = startX + static_cast<int>(FastMath::cosPhase(branchAngle) * branchLength);
+            int endY = startY + static_cast<int>(FastMath::sinPhase(branchAngle) * branchLength);
+
+            SDL_SetRenderDrawColor(renderer, 255, 230, 80, static_cast<Uint8>(150 * pulse));
+            SDL_RenderDrawLine(renderer, startX, startY, endX, endY);
+        }
+    }
+
+    // Aura externe - drastiquement simplifiée, seulement 3 cercles au lieu de plusieurs
+    for (int r = radius * 2; r < radius * 3; r += std::max(1, radius / 3)) {
+        float alpha = 30 * pulse * (1.0f - static_cast<float>(r - radius * 2) / static_cast<float>(radius));
+        SDL_SetRenderDrawColor(renderer, 255, 220, 50, static_cast<Uint8>(alpha));
+
+        // Dessiner seulement 12 points (tous les 30°) au lieu de 36 (tous les 10°)
+        for (int angle = 0; angle < 360; angle += 30) {
+            uint32_t pointAngle = FastMath::degreesToPhase(angle);
+            int x = centerX + static_cast<int>(FastMath::cosPhase(pointAngle) * r);
+            int y = centerY + static_cast<int>(FastMath::sinPhase(pointAngle) * r);
+            SDL_RenderDrawPoint(renderer, x, y);
+        }
+    }
+}
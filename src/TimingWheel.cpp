@@ -0,0 +1,154 @@
+#include "TimingWheel.hpp"
+
+TimingWheel::TimingWheel(int expectedTimers)
+    : freeList(NO_ENTRY),
+      currentTick(0),
+      activeCount(0) {
+    entries.reserve(expectedTimers);
+    reset(0);
+}
+
+TimingWheel::~TimingWheel() {}
+
+void TimingWheel::reset(int32_t tick) {
+    for (int slot = 0; slot < SLOT_COUNT; slot++) {
+        heads[slot] = NO_ENTRY;
+        tails[slot] = NO_ENTRY;
+    }
+
+    // Toutes les entrées redeviennent libres ; les références en cours
+    // deviennent périmées
+    freeList = NO_ENTRY;
+    for (int32_t index = static_cast<int32_t>(entries.size()) - 1; index >= 0; index--) {
+        Entry& entry = entries[index];
+        if (entry.slot != NO_ENTRY) {
+            entry.generation++;
+            entry.slot = NO_ENTRY;
+        }
+        entry.next = freeList;
+        freeList = index;
+    }
+
+    currentTick = tick;
+    activeCount = 0;
+}
+
+TimerHandle TimingWheel::schedule(int32_t tick, uint32_t payload) {
+    int32_t index = freeList;
+    if (index != NO_ENTRY) {
+        freeList = entries[index].next;
+    } else {
+        // Capacité atteinte : la roue grandit (jamais en régime établi)
+        Entry fresh = { 0, 0, 0, 0, NO_ENTRY, NO_ENTRY, NO_ENTRY };
+        index = static_cast<int32_t>(entries.size());
+        entries.push_back(fresh);
+    }
+
+    Entry& entry = entries[index];
+    entry.tick = tick;
+    entry.due = tick > currentTick ? tick : currentTick + 1;
+    entry.payload = payload;
+    insert(index);
+    activeCount++;
+
+    TimerHandle handle = { index, entry.generation };
+    return handle;
+}
+
+bool TimingWheel::cancel(TimerHandle handle) {
+    if (handle.entry < 0 || handle.entry >= static_cast<int32_t>(entries.size())) return false;
+
+    Entry& entry = entries[handle.entry];
+    if (entry.generation != handle.generation || entry.slot == NO_ENTRY) return false;
+
+    unlink(handle.entry);
+    release(handle.entry);
+    return true;
+}
+
+int TimingWheel::slotFor(int32_t due) const {
+    // Premier niveau dont les bits supérieurs sont communs avec la frame courante
+    uint32_t target = static_cast<uint32_t>(due);
+    uint32_t now = static_cast<uint32_t>(currentTick);
+    for (int level = 0; level < WheelLimits::LEVELS; level++) {
+        int shift = (level + 1) * WheelLimits::LEVEL_BITS;
+        if ((target >> shift) == (now >> shift)) {
+            int slot = static_cast<int>((target >> (level * WheelLimits::LEVEL_BITS)) & SLOT_MASK);
+            return level * WheelLimits::SLOTS_PER_LEVEL + slot;
+        }
+    }
+    return OVERFLOW_SLOT;
+}
+
+void TimingWheel::insert(int32_t index) {
+    // Ajout en fin de case : l'ordre de programmation est conservé
+    Entry& entry = entries[index];
+    int slot = slotFor(entry.due);
+    entry.slot = slot;
+    entry.prev = tails[slot];
+    entry.next = NO_ENTRY;
+    if (tails[slot] != NO_ENTRY) {
+        entries[tails[slot]].next = index;
+    } else {
+        heads[slot] = index;
+    }
+    tails[slot] = index;
+}
+
+void TimingWheel::unlink(int32_t index) {
+    Entry& entry = entries[index];
+    if (entry.prev != NO_ENTRY) {
+        entries[entry.prev].next = entry.next;
+    } else {
+        heads[entry.slot] = entry.next;
+    }
+    if (entry.next != NO_ENTRY) {
+        entries[entry.next].prev = entry.prev;
+    } else {
+        tails[entry.slot] = entry.prev;
+    }
+}
+
+void TimingWheel::release(int32_t index) {
+    Entry& entry = entries[index];
+    entry.generation++;
+    entry.slot = NO_ENTRY;
+    entry.next = freeList;
+    freeList = index;
+    activeCount--;
+}
+
+void TimingWheel::cascade() {
+    uint32_t now = static_cast<uint32_t>(currentTick);
+    if ((now & SLOT_MASK) != 0) return;
+
+    // Niveaux dont la frame courante vient de boucler, du plus haut au plus
+    // bas : une case redistribuée peut alimenter la case du niveau inférieur
+    // qui boucle en même temps
+    int topLevel = 1;
+    while (topLevel < WheelLimits::LEVELS &&
+           (now & ((1u << ((topLevel + 1) * WheelLimits::LEVEL_BITS)) - 1)) == 0) {
+        topLevel++;
+    }
+
+    if (topLevel == WheelLimits::LEVELS) {
+        redistribute(OVERFLOW_SLOT);
+        topLevel--;
+    }
+    for (int level = topLevel; level >= 1; level--) {
+        int slot = static_cast<int>((now >> (level * WheelLimits::LEVEL_BITS)) & SLOT_MASK);
+        redistribute(level * WheelLimits::SLOTS_PER_LEVEL + slot);
+    }
+}
+
+void TimingWheel::redistribute(int slot) {
+    int32_t index = heads[slot];
+    heads[slot] = NO_ENTRY;
+    tails[slot] = NO_ENTRY;
+
+    while (index != NO_ENTRY) {
+        int32_t next = entries[index].next;
+        insert(index);
+        index = next;
+    }
+}
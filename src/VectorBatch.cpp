@@ -0,0 +1,267 @@
+#include "VectorBatch.hpp"
+#include "SimMath.hpp"
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace VectorBatch {
+
+namespace {
+
+// Versions scalaires : traitent les éléments restants après les blocs
+// vectoriels, et tout le tableau sans SSE2. Mêmes opérations que les blocs.
+
+void distanceSquaredScalar(float px, float py, const float* x, const float* y, int begin, int count, float* out) {
+    for (int i = begin; i < count; i++) {
+        float dx = x[i] - px;
+        float dy = y[i] - py;
+        out[i] = dx * dx + dy * dy;
+    }
+}
+
+#ifdef AMAZING_BALL_FIXED_POINT
+// Virgule fixe : longueur de l'arithmétique de simulation (simLength), comme
+// les normalisations au cas par cas
+void normalizeSimulation(float* x, float* y, int count) {
+    for (int i = 0; i < count; i++) {
+        float length = simLength(x[i], y[i]);
+        x[i] = length > 0.0f ? x[i] / length : 0.0f;
+        y[i] = length > 0.0f ? y[i] / length : 0.0f;
+    }
+}
+#else
+void normalizeScalar(float* x, float* y, int begin, int count) {
+    for (int i = begin; i < count; i++) {
+        float length = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+        x[i] = length > 0.0f ? x[i] / length : 0.0f;
+        y[i] = length > 0.0f ? y[i] / length : 0.0f;
+    }
+}
+#endif
+
+int overlapCircleScalar(float cx, float cy, float radius,
+                        const float* x, const float* y, const float* radii, int begin, int count,
+                        int* out, int found, int maxOut) {
+    for (int i = begin; i < count && found < maxOut; i++) {
+        float dx = x[i] - cx;
+        float dy = y[i] - cy;
+        float reach = radius + radii[i];
+        if (dx * dx + dy * dy <= reach * reach) {
+            out[found++] = i;
+        }
+    }
+    return found;
+}
+
+// Meilleur candidat de [begin, count) ; une égalité garde le plus petit indice
+void nearestScalar(float px, float py, const float* x, const float* y, int begin, int count,
+                   int& best, float& bestDistanceSq) {
+    for (int i = begin; i < count; i++) {
+        float dx = x[i] - px;
+        float dy = y[i] - py;
+        float distanceSq = dx * dx + dy * dy;
+        if (best < 0 || distanceSq < bestDistanceSq) {
+            best = i;
+            bestDistanceSq = distanceSq;
+        }
+    }
+}
+
+#if defined(__AVX__)
+
+const int LANES = 8;
+typedef __m256 Lanes;
+
+inline Lanes load(const float* p) { return _mm256_loadu_ps(p); }
+inline void store(float* p, Lanes v) { _mm256_storeu_ps(p, v); }
+inline Lanes splat(float value) { return _mm256_set1_ps(value); }
+inline Lanes add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm256_div_ps(a, b); }
+inline Lanes squareRoot(Lanes a) { return _mm256_sqrt_ps(a); }
+inline Lanes lessThan(Lanes a, Lanes b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+inline Lanes lessEqual(Lanes a, Lanes b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+inline Lanes greaterThan(Lanes a, Lanes b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+inline Lanes select(Lanes mask, Lanes a, Lanes b) { return _mm256_blendv_ps(b, a, mask); }
+inline Lanes keep(Lanes mask, Lanes a) { return _mm256_and_ps(mask, a); }
+inline int bits(Lanes mask) { return _mm256_movemask_ps(mask); }
+inline Lanes laneIndices(int base) {
+    float b = static_cast<float>(base);
+    return _mm256_setr_ps(b, b + 1, b + 2, b + 3, b + 4, b + 5, b + 6, b + 7);
+}
+
+#elif defined(__SSE2__)
+
+const int LANES = 4;
+typedef __m128 Lanes;
+
+inline Lanes load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, Lanes v) { _mm_storeu_ps(p, v); }
+inline Lanes splat(float value) { return _mm_set1_ps(value); }
+inline Lanes add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm_div_ps(a, b); }
+inline Lanes squareRoot(Lanes a) { return _mm_sqrt_ps(a); }
+inline Lanes lessThan(Lanes a, Lanes b) { return _mm_cmplt_ps(a, b); }
+inline Lanes lessEqual(Lanes a, Lanes b) { return _mm_cmple_ps(a, b); }
+inline Lanes greaterThan(Lanes a, Lanes b) { return _mm_cmpgt_ps(a, b); }
+// SSE2 n'a pas de blendv : sélection par masques
+inline Lanes select(Lanes mask, Lanes a, Lanes b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+inline Lanes keep(Lanes mask, Lanes a) { return _mm_and_ps(mask, a); }
+inline int bits(Lanes mask) { return _mm_movemask_ps(mask); }
+inline Lanes laneIndices(int base) {
+    float b = static_cast<float>(base);
+    return _mm_setr_ps(b, b + 1, b + 2, b + 3);
+}
+
+#endif
+
+} // namespace
+
+#if defined(__AVX__) || defined(__SSE2__)
+
+const char* instructionSet() {
+#if defined(__AVX__)
+    return "AVX";
+#else
+    return "SSE2";
+#endif
+}
+
+void distanceSquared(float px, float py, const float* x, const float* y, int count, float* out) {
+    Lanes pointX = splat(px);
+    Lanes pointY = splat(py);
+    int i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        Lanes dx = sub(load(x + i), pointX);
+        Lanes dy = sub(load(y + i), pointY);
+        store(out + i, add(mul(dx, dx), mul(dy, dy)));
+    }
+    distanceSquaredScalar(px, py, x, y, i, count, out);
+}
+
+void normalize(float* x, float* y, int count) {
+#ifdef AMAZING_BALL_FIXED_POINT
+    normalizeSimulation(x, y, count);
+#else
+    Lanes zero = splat(0.0f);
+    int i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        Lanes vx = load(x + i);
+        Lanes vy = load(y + i);
+        Lanes length = squareRoot(add(mul(vx, vx), mul(vy, vy)));
+        // 0/0 donne NaN : le masque remet les vecteurs nuls à zéro
+        Lanes nonZero = greaterThan(length, zero);
+        store(x + i, keep(nonZero, div(vx, length)));
+        store(y + i, keep(nonZero, div(vy, length)));
+    }
+    normalizeScalar(x, y, i, count);
+#endif
+}
+
+int overlapCircle(float cx, float cy, float radius,
+                  const float* x, const float* y, const float* radii, int count,
+                  int* out, int maxOut) {
+    Lanes centerX = splat(cx);
+    Lanes centerY = splat(cy);
+    Lanes ownRadius = splat(radius);
+    int found = 0;
+    int i = 0;
+    for (; i + LANES <= count && found < maxOut; i += LANES) {
+        Lanes dx = sub(load(x + i), centerX);
+        Lanes dy = sub(load(y + i), centerY);
+        Lanes reach = add(ownRadius, load(radii + i));
+        int hits = bits(lessEqual(add(mul(dx, dx), mul(dy, dy)), mul(reach, reach)));
+        // Les bits du masque sont dans l'ordre des indices
+        for (int lane = 0; hits != 0 && found < maxOut; lane++, hits >>= 1) {
+            if (hits & 1) out[found++] = i + lane;
+        }
+    }
+    if (found >= maxOut) return found;
+    return overlapCircleScalar(cx, cy, radius, x, y, radii, i, count, out, found, maxOut);
+}
+
+int nearest(float px, float py, const float* x, const float* y, int count, float* distanceSq) {
+    int best = -1;
+    float bestDistanceSq = 0.0f;
+    int i = 0;
+
+    if (count >= LANES) {
+        // Meilleur candidat par voie (premier indice en cas d'égalité), puis
+        // réduction entre les voies
+        Lanes pointX = splat(px);
+        Lanes pointY = splat(py);
+        Lanes laneBest = splat(0.0f);
+        Lanes laneIndex = laneIndices(0);
+        {
+            Lanes dx = sub(load(x), pointX);
+            Lanes dy = sub(load(y), pointY);
+            laneBest = add(mul(dx, dx), mul(dy, dy));
+        }
+        for (i = LANES; i + LANES <= count; i += LANES) {
+            Lanes dx = sub(load(x + i), pointX);
+            Lanes dy = sub(load(y + i), pointY);
+            Lanes candidate = add(mul(dx, dx), mul(dy, dy));
+            Lanes closer = lessThan(candidate, laneBest);
+            laneBest = select(closer, candidate, laneBest);
+            laneIndex = select(closer, laneIndices(i), laneIndex);
+        }
+
+        float bestValues[LANES];
+        float bestIndices[LANES];
+        store(bestValues, laneBest);
+        store(bestIndices, laneIndex);
+        for (int lane = 0; lane < LANES; lane++) {
+            int index = static_cast<int>(bestIndices[lane]);
+            if (best < 0 || bestValues[lane] < bestDistanceSq ||
+                (bestValues[lane] == bestDistanceSq && index < best)) {
+                best = index;
+                bestDistanceSq = bestValues[lane];
+            }
+        }
+    }
+
+    // Éléments restants : indices plus grands que tous ceux des voies
+    nearestScalar(px, py, x, y, i, count, best, bestDistanceSq);
+    if (best >= 0 && distanceSq) *distanceSq = bestDistanceSq;
+    return best;
+}
+
+#else
+
+const char* instructionSet() {
+    return "scalaire";
+}
+
+void distanceSquared(float px, float py, const float* x, const float* y, int count, float* out) {
+    distanceSquaredScalar(px, py, x, y, 0, count, out);
+}
+
+void normalize(float* x, float* y, int count) {
+#ifdef AMAZING_BALL_FIXED_POINT
+    normalizeSimulation(x, y, count);
+#else
+    normalizeScalar(x, y, 0, count);
+#endif
+}
+
+int overlapCircle(float cx, float cy, float radius,
+                  const float* x, const float* y, const float* radii, int count,
+                  int* out, int maxOut) {
+    return overlapCircleScalar(cx, cy, radius, x, y, radii, 0, count, out, 0, maxOut);
+}
+
+int nearest(float px, float py, const float* x, const float* y, int count, float* distanceSq) {
+    int best = -1;
+    float bestDistanceSq = 0.0f;
+    nearestScalar(px, py, x, y, 0, count, best, bestDistanceSq);
+    if (best >= 0 && distanceSq) *distanceSq = bestDistanceSq;
+    return best;
+}
+
+#endif
+
+} // namespace VectorBatch
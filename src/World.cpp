@@ -0,0 +1,525 @@
+#include "World.hpp"
+#include "Player.hpp"
+#include "Room.hpp"
+#include "RoomBuilder.hpp"
+#include "Random.hpp"
+#include "Snapshot.hpp"
+#include "SimMath.hpp"
+#include "Collision.hpp"
+#include "Hitbox.hpp"
+#include "FrameProfiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Demi-largeur de la zone de l'épée
+const float SWORD_HALF_WIDTH = 15.0f;
+
+// Cellules de la phase large des ennemis
+const float ENEMY_CELL_SIZE = 64.0f;
+// Rayon d'un ennemi (12) élargi de son déplacement d'une frame, recul
+// compris : capacité de la grille (voir buildEnemyBroadphase)
+const float ENEMY_BOUNDS_MAX_RADIUS = 32.0f;
+
+} // namespace
+
+static_assert(World::MAX_ENEMIES <= SnapshotLimits::MAX_ENEMIES,
+              "L'instantané doit contenir tous les ennemis");
+
+World::World(int width, int height)
+    : width(width),
+      height(height),
+      enemyGrid(static_cast<float>(width), static_cast<float>(height), ENEMY_CELL_SIZE,
+                MAX_ENEMIES, ENEMY_BOUNDS_MAX_RADIUS),
+      crowd(width, height, MAX_ENEMIES),
+      aiScheduler(MAX_ENEMIES),
+      roomBuilder(nullptr),
+      nextRoomRequested(false),
+      runSeed(0),
+      difficulty(Difficulty::MEDIUM),
+      inRoom(false),
+      currentLevel(1),
+      totalScore(0),
+      totalTime(0.0f),
+      playerLives(3),
+      playerHealth(12),
+      invincibilityFrames(0),
+      gameOver(false),
+      timerStarted(false),
+      celebrationTimer(0.0f) {
+
+    // Initialiser le joueur au centre de l'écran
+    player = std::make_unique<Player>(width / 2, height / 2);
+
+    // Créer quelques ennemis (mode exploration)
+    enemies.reserve(MAX_ENEMIES);
+    enemyStart.reserve(MAX_ENEMIES);
+    enemyBoundsX.reserve(MAX_ENEMIES);
+    enemyBoundsY.reserve(MAX_ENEMIES);
+    enemyBoundsRadius.reserve(MAX_ENEMIES);
+    nearbyEnemies.reserve(MAX_ENEMIES);
+    enemies.emplace_back(200, 150, Random::deriveSeed(runSeed, RandomStream::PATROL, 0, 0, 0));
+    enemies.emplace_back(600, 200, Random::deriveSeed(runSeed, RandomStream::PATROL, 0, 0, 1));
+    enemies.emplace_back(400, 400, Random::deriveSeed(runSeed, RandomStream::PATROL, 0, 0, 2));
+    enemies.emplace_back(150, 450, Random::deriveSeed(runSeed, RandomStream::PATROL, 0, 0, 3));
+    aiScheduler.attach(enemies);
+}
+
+World::~World() {
+    // Une préparation en cours écrit encore dans nextRoom
+    if (roomBuilder && nextRoomRequested) {
+        roomBuilder->wait();
+    }
+}
+
+void World::start(Difficulty newDifficulty, int level, uint64_t newRunSeed) {
+    difficulty = newDifficulty;
+    runSeed = newRunSeed;
+    inRoom = true;
+    currentLevel = level;
+    totalScore = 0; // Réinitialiser le score total
+    totalTime = 0.0f; // Réinitialiser le temps total
+    playerLives = 3; // Réinitialiser les vies
+    playerHealth = 12; // 3 cœurs × 4 quarts = 12
+    invincibilityFrames = 0;
+    gameOver = false; // Réinitialiser le game over
+    timerStarted = false;
+    celebrationTimer = 0.0f;
+
+    // Placer le joueur dans la zone de départ (à gauche)
+    player->reset(80, height / 2);
+
+    // Créer la salle avec la difficulté choisie
+    // (réutilisée d'une partie à l'autre)
+    // La salle suivante a pu être demandée lors de la partie précédente
+    if (roomBuilder && nextRoomRequested) {
+        roomBuilder->wait();
+    }
+    nextRoomRequested = false;
+    if (currentRoom) {
+        currentRoom->reset(currentLevel, difficulty, runSeed);
+    } else {
+        currentRoom = std::make_unique<Room>(width, height, currentLevel, difficulty, runSeed);
+    }
+    // Seconde salle seulement si elle peut être préparée en arrière-plan
+    if (roomBuilder && !nextRoom) {
+        nextRoom = std::make_unique<Room>(width, height, currentLevel + 1, difficulty, runSeed);
+    }
+
+    // Pas d'ennemis au premier niveau
+    spawnEnemies();
+}
+
+void World::endGame(WorldEvents& events) {
+    playerHealth = 0;
+    playerLives = 0;
+
+    // Un contact avec l'étoile après la fin ne termine pas la partie une seconde fois
+    if (gameOver) return;
+    gameOver = true;
+    currentRoom->stopTimer();
+
+    // Score total + score du niveau actuel
+    events.gameOver = true;
+    events.finalScore = totalScore + currentRoom->getScore();
+}
+
+void World::spawnEnemies() {
+    // Créer des ennemis à partir du niveau 2
+    // Les scripts des ennemis précédents sont abandonnés dans tous les cas
+    enemies.clear();
+    if (currentLevel < 2) {
+        aiScheduler.attach(enemies);
+        return;
+    }
+
+    int numEnemies = 1 + (currentLevel - 2); // 1 ennemi au niveau 2, 2 au niveau 3, etc.
+    if (numEnemies > MAX_ENEMIES) numEnemies = MAX_ENEMIES; // Maximum 4 ennemis
+
+    int difficultyValue = static_cast<int>(difficulty);
+    Random spawnRandom(Random::deriveSeed(runSeed, RandomStream::ENEMY_SPAWN, currentLevel, difficultyValue));
+
+    for (int i = 0; i < numEnemies; i++) {
+        // Positionner les ennemis dans la partie droite de la salle
+        float enemyX = 400 + spawnRandom.nextInt(300);
+        float enemyY = 100 + spawnRandom.nextInt(400);
+        uint64_t patrolSeed = Random::deriveSeed(runSeed, RandomStream::PATROL, currentLevel, difficultyValue, i);
+        enemies.emplace_back(enemyX, enemyY, patrolSeed);
+    }
+    aiScheduler.attach(enemies);
+}
+
+void World::recordEnemyStarts() {
+    enemyStart.resize(enemies.size());
+    for (size_t i = 0; i < enemies.size(); i++) {
+        enemyStart[i] = enemies[i].getPosition();
+    }
+}
+
+void World::buildEnemyBroadphase() {
+    size_t count = enemies.size();
+    enemyBoundsX.resize(count);
+    enemyBoundsY.resize(count);
+    enemyBoundsRadius.resize(count);
+    nearbyEnemies.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        Vector2D position = enemies[i].getPosition();
+        // Rayon élargi du déplacement de la frame (borne sans sqrt) : la
+        // boîte couvre aussi le test continu des contacts
+        float moved = std::abs(position.x - enemyStart[i].x) + std::abs(position.y - enemyStart[i].y);
+        enemyBoundsX[i] = position.x;
+        enemyBoundsY[i] = position.y;
+        enemyBoundsRadius[i] = static_cast<float>(enemies[i].getRadius()) + moved;
+    }
+
+    enemyGrid.build(static_cast<int>(count), enemyBoundsX.data(), enemyBoundsY.data(), enemyBoundsRadius.data());
+}
+
+void World::applyPlayerAttack(const Vector2D& playerPos) {
+    // Détection de collision entre l'attaque du joueur et les ennemis
+    if (!player->isAttacking()) return;
+
+    // Le centre de l'ennemi doit être dans la zone de l'épée
+    Hitbox::Capsule sword = Hitbox::orientedCapsule(playerPos, player->getDirection(),
+                                                    static_cast<float>(player->getAttackRange()), SWORD_HALF_WIDTH);
+    float minX, minY, maxX, maxY;
+    Hitbox::bounds(sword, minX, minY, maxX, maxY);
+    int found = enemyGrid.query(minX, minY, maxX, maxY, nearbyEnemies.data(), static_cast<int>(nearbyEnemies.size()));
+
+    for (int k = 0; k < found; k++) {
+        Enemy& enemy = enemies[nearbyEnemies[k]];
+        if (enemy.isDead()) continue;
+
+        if (Hitbox::overlapsCircle(sword, enemy.getPosition(), 0.0f)) {
+            enemy.takeDamage(1, playerPos);
+        }
+    }
+}
+
+bool World::jump() {
+    return player->jump();
+}
+
+bool World::attack() {
+    return player->attack();
+}
+
+void World::update(uint8_t heldKeys, WorldEvents& events) {
+    // Position en début de frame pour les tests de collision continus
+    Vector2D frameStart = player->getPosition();
+    bool wasGrounded = player->getIsGrounded();
+
+    player->handleInput(heldKeys);
+    player->update();
+
+    Vector2D playerPos = player->getPosition();
+
+    if (!inRoom || !currentRoom) {
+        // Mode exploration avec ennemis (ancien mode)
+        recordEnemyStarts();
+        crowd.apply(enemies);
+        aiScheduler.update(enemies, playerPos, nullptr);
+
+        buildEnemyBroadphase();
+        applyPlayerAttack(playerPos);
+
+        // Supprimer les ennemis morts (les scripts suivent les indices)
+        size_t aliveBefore = enemies.size();
+        enemies.erase(
+            std::remove_if(enemies.begin(), enemies.end(),
+                [](const Enemy& e) { return e.isDead(); }),
+            enemies.end()
+        );
+        if (enemies.size() != aliveBefore) {
+            aiScheduler.attach(enemies);
+        }
+        return;
+    }
+
+    // Bloquer le mouvement vers les étoiles électriques APRÈS tous les mouvements du joueur
+    // (test continu : un recul rapide ne traverse pas l'étoile). Seules les
+    // étoiles proches du trajet de la frame sont testées, dans l'ordre des indices.
+    const HazardSystem& hazards = currentRoom->getHazards();
+    int nearbyHazards[HazardLimits::MAX_HAZARDS];
+    int nearbyCount = hazards.queryPath(frameStart, player->getPosition(), static_cast<float>(player->getRadius()),
+                                        nearbyHazards, HazardLimits::MAX_HAZARDS);
+    for (int k = 0; k < nearbyCount; k++) {
+        int hazard = nearbyHazards[k];
+        player->blockSweptMovement(frameStart, hazards.getPosition(hazard),
+                                   static_cast<int>(hazards.getRadius(hazard)));
+    }
+
+    playerPos = player->getPosition(); // Mettre à jour la position après le blocage
+
+    // Mettre à jour la salle (timer, particules, animations)
+    currentRoom->update(1.0f / 60.0f);
+
+    // Démarrer le timer si le joueur quitte la zone de départ
+    if (!timerStarted && playerPos.x > 100) {
+        currentRoom->startTimer();
+        timerStarted = true;
+    }
+
+    // Vérifier si le joueur est tombé dans un trou (seulement s'il est au sol).
+    // Resté au sol toute la frame, tout le trajet compte : un grand pas ne
+    // saute pas par-dessus un trou.
+    float holeT;
+    bool fellInHole = player->getIsGrounded() &&
+        (currentRoom->isPlayerInHole(playerPos, player->getRadius()) ||
+         (wasGrounded && currentRoom->sweepHoles(frameStart, playerPos, player->getRadius(), holeT)));
+    bool respawned = false;
+    if (fellInHole && !gameOver) {
+        // Perdre une vie complète (4 quarts de cœur)
+        playerHealth -= 4;
+        if (playerHealth < 0) playerHealth = 0;
+        playerLives = (playerHealth + 3) / 4;
+
+        if (playerHealth <= 0) {
+            endGame(events);
+        }
+        // Réinitialiser le joueur à la position de départ
+        player->reset(80, height / 2);
+        // Téléportation : les tests continus repartent du point de départ
+        frameStart = playerPos = player->getPosition();
+        respawned = true;
+        // Réinitialiser l'invincibilité
+        invincibilityFrames = invincibilityDuration;
+        // Ne PAS réinitialiser timerStarted - le timer continue
+    }
+
+    // Vérifier si le joueur a atteint la fin de la salle
+    if (currentRoom->hasReachedEnd(playerPos) && !currentRoom->isCelebrating() && !gameOver) {
+        // Arrêter le timer et créer l'explosion de fête
+        currentRoom->stopTimer();
+        currentRoom->createCelebrationParticles(playerPos);
+
+        // Profiter des 2 secondes de célébration pour générer le niveau suivant
+        if (roomBuilder && nextRoom) {
+            roomBuilder->request(nextRoom.get(), currentLevel + 1, difficulty, runSeed);
+            nextRoomRequested = true;
+        }
+    }
+
+    // Si la célébration est terminée, passer au niveau suivant
+    if (currentRoom->isCelebrating() && currentRoom->getScore() >= 0 && !gameOver) {
+        celebrationTimer += 1.0f / 60.0f;
+
+        if (celebrationTimer > 2.0f) { // Attendre 2 secondes
+            celebrationTimer = 0.0f;
+            timerStarted = false;
+
+            // Ajouter le score et le temps du niveau actuel au total
+            totalScore += currentRoom->getScore();
+            totalTime += currentRoom->getElapsedTime();
+
+            // Passer au niveau suivant
+            currentLevel++;
+
+            // Réinitialiser le joueur à la position de départ
+            player->reset(80, height / 2);
+            frameStart = playerPos = player->getPosition();
+            respawned = true;
+
+            // Basculer sur la salle préparée en arrière-plan (normalement
+            // terminée depuis longtemps, wait() ne bloque pas)
+            if (nextRoomRequested) {
+                roomBuilder->wait();
+                std::swap(currentRoom, nextRoom);
+                nextRoomRequested = false;
+            } else {
+                currentRoom->reset(currentLevel, difficulty, runSeed);
+            }
+
+            spawnEnemies();
+        }
+    }
+
+    // Mettre à jour les ennemis dans la salle
+    recordEnemyStarts();
+    {
+        PROFILE_SCOPE(ProfilePhase::ENEMY_AI);
+        crowd.apply(enemies);
+        aiScheduler.update(enemies, playerPos, currentRoom.get());
+    }
+
+    buildEnemyBroadphase();
+    applyPlayerAttack(playerPos);
+
+    // Décrémenter les frames d'invincibilité
+    if (invincibilityFrames > 0) {
+        invincibilityFrames--;
+    }
+
+    // Mettre à jour l'état d'invincibilité du joueur
+    player->setInvincible(invincibilityFrames > 0);
+
+    // Détection de collision entre le joueur et les ennemis : seuls ceux dont
+    // la boîte croise le trajet du joueur pendant la frame sont testés
+    float playerRadius = static_cast<float>(player->getRadius());
+    int contactCount = enemyGrid.query(std::min(frameStart.x, playerPos.x) - playerRadius,
+                                       std::min(frameStart.y, playerPos.y) - playerRadius,
+                                       std::max(frameStart.x, playerPos.x) + playerRadius,
+                                       std::max(frameStart.y, playerPos.y) + playerRadius,
+                                       nearbyEnemies.data(), static_cast<int>(nearbyEnemies.size()));
+    for (int k = 0; k < contactCount; k++) {
+        int i = nearbyEnemies[k];
+        const Enemy& enemy = enemies[i];
+        if (enemy.isDead()) continue;
+
+        Vector2D enemyPos = enemy.getPosition();
+        float dx = enemyPos.x - playerPos.x;
+        float dy = enemyPos.y - playerPos.y;
+        float distance = simLength(dx, dy);
+        float contactDistance = static_cast<float>(player->getRadius() + enemy.getRadius());
+
+        // Test continu sur le mouvement relatif pendant la frame : ennemi et
+        // joueur ne se croisent pas sans se toucher (sauf après une
+        // téléportation : chute dans un trou ou changement de salle)
+        float contactT;
+        bool crossed = !respawned &&
+            Collision::sweepCircle(enemyStart[i] - frameStart, enemyPos - playerPos,
+                                   Vector2D(0, 0), contactDistance, contactT);
+
+        // Collision si la distance entre centres < somme des rayons
+        if (distance < contactDistance || crossed) {
+            if (invincibilityFrames == 0 && !gameOver) {
+                // Perdre 1/4 de cœur
+                playerHealth--;
+
+                // Mettre à jour playerLives pour l'affichage
+                playerLives = (playerHealth + 3) / 4; // Arrondir au cœur supérieur
+
+                if (playerHealth <= 0) {
+                    endGame(events);
+                }
+
+                // Appliquer un knockback (repousser le joueur)
+                player->applyKnockback(enemyPos);
+
+                // Activer l'invincibilité
+                invincibilityFrames = invincibilityDuration;
+
+                // Ne vérifier qu'une collision par frame
+                break;
+            }
+        }
+    }
+
+    // Vérifier collision avec les étoiles électriques pour les dégâts
+    int touchedHazard = currentRoom->getHazards().findContact(playerPos, static_cast<float>(player->getRadius()));
+    if (touchedHazard >= 0) {
+        // Perdre 1/4 de cœur seulement si pas invincible
+        if (invincibilityFrames == 0) {
+            // Appliquer le recul au premier contact, loin de l'étoile touchée
+            player->applyKnockback(currentRoom->getHazards().getPosition(touchedHazard));
+
+            playerHealth--;
+
+            // Mettre à jour playerLives pour l'affichage
+            playerLives = (playerHealth + 3) / 4;
+
+            if (playerHealth <= 0) {
+                endGame(events);
+            }
+
+            // Activer l'invincibilité
+            invincibilityFrames = invincibilityDuration;
+        }
+    }
+}
+
+bool World::saveState(WorldSnapshot& snapshot) const {
+    // Remise à zéro complète (octets de remplissage compris) : deux
+    // instantanés d'un même état sont identiques octet par octet
+    snapshot = WorldSnapshot();
+
+    snapshot.magic = WorldSnapshot::MAGIC;
+    snapshot.version = WorldSnapshot::VERSION;
+    snapshot.width = width;
+    snapshot.height = height;
+    snapshot.runSeed = runSeed;
+    snapshot.difficulty = static_cast<int32_t>(difficulty);
+    snapshot.currentLevel = currentLevel;
+    snapshot.totalScore = totalScore;
+    snapshot.totalTime = totalTime;
+    snapshot.playerLives = playerLives;
+    snapshot.playerHealth = playerHealth;
+    snapshot.invincibilityFrames = invincibilityFrames;
+    snapshot.celebrationTimer = celebrationTimer;
+    snapshot.inRoom = inRoom;
+    snapshot.gameOver = gameOver;
+    snapshot.timerStarted = timerStarted;
+    snapshot.hasRoom = currentRoom != nullptr;
+    snapshot.aiTick = aiScheduler.getTick();
+
+    player->saveState(snapshot.player);
+
+    if (currentRoom && !currentRoom->saveState(snapshot.room)) {
+        return false;
+    }
+
+    snapshot.enemyCount = static_cast<int32_t>(enemies.size());
+    for (size_t i = 0; i < enemies.size(); i++) {
+        enemies[i].saveState(snapshot.enemies[i]);
+    }
+    return true;
+}
+
+bool World::loadState(const WorldSnapshot& snapshot) {
+    // Tout est vérifié avant la première écriture : un instantané refusé
+    // laisse la partie en cours intacte
+    if (!validateSnapshot(snapshot) ||
+        snapshot.width != width || snapshot.height != height ||
+        snapshot.enemyCount > MAX_ENEMIES) {
+        return false;
+    }
+
+    // Une préparation en cours écrit encore dans nextRoom. Elle est
+    // abandonnée : la salle suivante sera régénérée (à l'identique, elle ne
+    // dépend que de la graine) si la célébration restaurée est déjà en cours.
+    if (roomBuilder && nextRoomRequested) {
+        roomBuilder->wait();
+    }
+    nextRoomRequested = false;
+
+    runSeed = snapshot.runSeed;
+    difficulty = static_cast<Difficulty>(snapshot.difficulty);
+    currentLevel = snapshot.currentLevel;
+    totalScore = snapshot.totalScore;
+    totalTime = snapshot.totalTime;
+    playerLives = snapshot.playerLives;
+    playerHealth = snapshot.playerHealth;
+    invincibilityFrames = snapshot.invincibilityFrames;
+    celebrationTimer = snapshot.celebrationTimer;
+    inRoom = snapshot.inRoom != 0;
+    gameOver = snapshot.gameOver != 0;
+    timerStarted = snapshot.timerStarted != 0;
+
+    player->loadState(snapshot.player);
+
+    if (snapshot.hasRoom) {
+        if (!currentRoom) {
+            currentRoom = std::make_unique<Room>(width, height, snapshot.room.level,
+                                                 static_cast<Difficulty>(snapshot.room.difficulty), runSeed);
+        }
+        currentRoom->loadState(snapshot.room);
+        if (roomBuilder && !nextRoom) {
+            nextRoom = std::make_unique<Room>(width, height, currentLevel + 1, difficulty, runSeed);
+        }
+    }
+
+    // Capacité réservée à la construction : pas de réallocation
+    enemies.clear();
+    for (int i = 0; i < snapshot.enemyCount; i++) {
+        const EnemySnapshot& enemySnapshot = snapshot.enemies[i];
+        enemies.emplace_back(enemySnapshot.position.x, enemySnapshot.position.y, 0);
+        enemies.back().loadState(enemySnapshot);
+    }
+
+    // Les scripts repartent de l'état restauré de chaque ennemi
+    aiScheduler.setTick(snapshot.aiTick);
+    aiScheduler.attach(enemies);
+    return true;
+}
@@ -1,12 +1,47 @@
 #include "Game.hpp"
+#include "FrameProfiler.hpp"
+#include "AllocationTracker.hpp"
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
 
-int main(int, char**) {
+int main(int argc, char** argv) {
     const int WINDOW_WIDTH = 800;
     const int WINDOW_HEIGHT = 600;
 
     Game game;
 
+    // --seed N : rejouer exactement les mêmes salles et ennemis
+    // --record fichier : enregistrer les entrées de la session
+    // --replay fichier : rejouer une session enregistrée
+    // --tick-rate N : cadence de la boucle (diviseur de 60, ex. 30 sur une
+    //                 machine lente), la simulation restant à 60 pas par seconde
+    // --vsync : présentation synchronisée sur l'écran
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            game.setSeed(std::strtoull(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            if (!game.setTickRate(std::atoi(argv[++i]))) {
+                return -1;
+            }
+        } else if (std::strcmp(argv[i], "--vsync") == 0) {
+            game.setVsync(true);
+        }
+    }
+
+    if (replayPath && !game.startReplay(replayPath)) {
+        return -1;
+    }
+    if (recordPath && !game.startRecording(recordPath)) {
+        return -1;
+    }
+
     if (!game.init("Amazing Ball", WINDOW_WIDTH, WINDOW_HEIGHT)) {
         std::cerr << "Échec de l'initialisation du jeu!" << std::endl;
         return -1;
@@ -20,9 +55,19 @@ int main(int, char**) {
     std::cout << "======================" << std::endl;
 
     while (game.running()) {
+        // Écran fixe ou fenêtre cachée : attendre un événement plutôt que
+        // de refaire 60 frames identiques par seconde
+        game.waitWhileIdle();
+        if (!game.running()) break;
+
+        PROFILE_FRAME_BEGIN();
+        AllocationTracker::beginFrame(game.isSteadyGameplay());
         game.handleEvents();
         game.update();
         game.render();
+        AllocationTracker::endFrame();
+        PROFILE_FRAME_END();
+        game.waitForNextFrame();
     }
 
     game.clean();
@@ -0,0 +1,163 @@
+// Validation des scores annoncés : rejoue sans affichage chaque replay
+// (<dossier>/*.rep) et compare les scores obtenus à ceux du fichier
+// "<replay>.scores" écrit par ScoreManager lors de l'enregistrement.
+//
+// Utilisation: amazing_ball_validator <dossier> [threads]
+
+#include "Simulation.hpp"
+#include "Replay.hpp"
+#include "ScoreManager.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Taille de la fenêtre du jeu (main.cpp) : les salles en dépendent
+const int WINDOW_WIDTH = 800;
+const int WINDOW_HEIGHT = 600;
+
+enum class RunStatus {
+    VALID,
+    MISMATCH,
+    ERROR
+};
+
+struct RunJob {
+    std::string replayPath;
+    RunStatus status;
+    std::string message;
+};
+
+// Rejoue un enregistrement et compare les scores de chaque partie terminée
+void validateRun(RunJob& job) {
+    std::vector<ScoreRecord> claimed;
+    if (!ScoreManager::loadRecords(job.replayPath + ".scores", claimed)) {
+        job.status = RunStatus::ERROR;
+        job.message = "scores annoncés illisibles";
+        return;
+    }
+
+    InputReplay replay;
+    if (!replay.open(job.replayPath.c_str())) {
+        job.status = RunStatus::ERROR;
+        job.message = "replay illisible";
+        return;
+    }
+
+    Simulation simulation(WINDOW_WIDTH, WINDOW_HEIGHT);
+    simulation.setSeed(replay.getSeed());
+
+    std::vector<ScoreRecord> computed;
+    InputFrame frame;
+    SimulationEvents events;
+    while (replay.nextFrame(frame)) {
+        events.clear();
+        simulation.step(frame, events);
+
+        if (events.gameOver) {
+            ScoreRecord record;
+            record.score = events.finalScore;
+            record.difficulty = simulation.getDifficulty();
+            computed.push_back(record);
+        }
+        if (events.quit) {
+            break;
+        }
+    }
+
+    if (computed.size() != claimed.size()) {
+        job.status = RunStatus::MISMATCH;
+        job.message = std::to_string(claimed.size()) + " parties annoncées, " +
+                      std::to_string(computed.size()) + " rejouées";
+        return;
+    }
+
+    for (size_t i = 0; i < computed.size(); i++) {
+        if (computed[i].score != claimed[i].score || computed[i].difficulty != claimed[i].difficulty) {
+            job.status = RunStatus::MISMATCH;
+            job.message = "partie " + std::to_string(i + 1) + " : score annoncé " +
+                          std::to_string(claimed[i].score) + ", score rejoué " +
+                          std::to_string(computed[i].score);
+            return;
+        }
+    }
+
+    job.status = RunStatus::VALID;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Utilisation: " << argv[0] << " <dossier de replays> [threads]" << std::endl;
+        return 2;
+    }
+
+    std::vector<RunJob> jobs;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(argv[1], error)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".rep") {
+            RunJob job;
+            job.replayPath = entry.path().string();
+            job.status = RunStatus::ERROR;
+            jobs.push_back(job);
+        }
+    }
+    if (error) {
+        std::cerr << "Erreur: Impossible de lire le dossier " << argv[1] << " (" << error.message() << ")" << std::endl;
+        return 2;
+    }
+    // Ordre stable du rapport, indépendant du système de fichiers
+    std::sort(jobs.begin(), jobs.end(),
+              [](const RunJob& a, const RunJob& b) { return a.replayPath < b.replayPath; });
+
+    int threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    if (argc >= 3) {
+        threadCount = std::atoi(argv[2]);
+    }
+    if (threadCount < 1) threadCount = 1;
+    if (threadCount > static_cast<int>(jobs.size())) threadCount = std::max(1, static_cast<int>(jobs.size()));
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Une simulation par replay ; chaque thread prend le replay suivant
+    std::atomic<size_t> nextJob(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&jobs, &nextJob] {
+            size_t index;
+            while ((index = nextJob.fetch_add(1)) < jobs.size()) {
+                validateRun(jobs[index]);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    int valid = 0;
+    int rejected = 0;
+    for (const auto& job : jobs) {
+        if (job.status == RunStatus::VALID) {
+            valid++;
+            continue;
+        }
+        rejected++;
+        std::cout << (job.status == RunStatus::MISMATCH ? "REJETÉ  " : "ERREUR  ")
+                  << job.replayPath << " : " << job.message << std::endl;
+    }
+
+    std::cout << valid << " replays valides, " << rejected << " rejetés en "
+              << elapsed.count() << " s (" << threadCount << " threads)" << std::endl;
+
+    return rejected == 0 ? 0 : 1;
+}